@@ -0,0 +1,107 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-06-20
+ *
+ * Description: Measures insert/find throughput of the BasicRedBlackTree engine
+ * for an integer-key index and the composite (sid, subject) registration key,
+ * with lookups done one at a time and through the interleaved findBatch.
+ * Lookups run in a shuffled order so that a large tree misses cache. Each
+ * key type is measured with bottom-up and top-down insertion.
+ * Usage: ./RBTEngineBench [node_count]
+ */
+#include "../../src/design_assignment_01/basic_red_black_tree.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+using namespace std;
+
+typedef chrono::steady_clock BenchClock;
+
+// Returns nanoseconds per operation since 'start' for 'count' operations.
+static double nanosPerOp(const BenchClock::time_point &start, size_t count) {
+  const double elapsed =
+      chrono::duration<double, nano>(BenchClock::now() - start).count();
+  return elapsed / static_cast<double>(count);
+}
+
+// Inserts and then looks up every key, reporting ns/op for both phases.
+template <typename Tree, typename Key>
+static void runBenchmark(const string &name, const vector<Key> &keys,
+                         InsertMode mode) {
+  Tree tree;
+  tree.setInsertMode(mode);
+  BenchClock::time_point start = BenchClock::now();
+  for (const Key &key : keys) {
+    tree.insert(key, EmptyPayload());
+  }
+  const double insert_ns = nanosPerOp(start, keys.size());
+
+  vector<Key> lookups = keys;
+  shuffle(lookups.begin(), lookups.end(), mt19937(17));
+
+  size_t found = 0;
+  start = BenchClock::now();
+  for (const Key &key : lookups) {
+    found += (tree.find(key) != nullptr);
+  }
+  const double find_ns = nanosPerOp(start, lookups.size());
+
+  // Batches of the size a driver window would hand over.
+  const size_t batch_size = 64;
+  vector<typename Tree::Node *> results(batch_size);
+  size_t batch_found = 0;
+  start = BenchClock::now();
+  for (size_t i = 0; i < lookups.size(); i += batch_size) {
+    const size_t count = min(batch_size, lookups.size() - i);
+    tree.findBatch(lookups.data() + i, count, results.data());
+    for (size_t j = 0; j < count; j++)
+      batch_found += (results[j] != nullptr);
+  }
+  const double batch_ns = nanosPerOp(start, lookups.size());
+
+  cout << name
+       << ((mode == InsertMode::kTopDown) ? " top-down" : " bottom-up")
+       << ": nodes=" << tree.size() << " insert=" << insert_ns
+       << " ns/op find=" << find_ns << " ns/op findBatch=" << batch_ns
+       << " ns/op (found " << found << "/" << batch_found << ")\n";
+}
+
+int main(int argc, char **argv) {
+  const size_t node_count =
+      (argc > 1) ? strtoul(argv[1], nullptr, 10) : 1000000;
+  mt19937 generator(20250608);
+
+  // Integer keys (timestamp / sid alone).
+  vector<int> int_keys(node_count);
+  for (int &key : int_keys) {
+    key = static_cast<int>(generator());
+  }
+
+  // Composite keys drawn from a small catalog of subjects.
+  static const char *kSubjects[] = {"Algorithms", "Misaso",  "Mathmatics",
+                                    "Physics",    "Chemistry", "Database",
+                                    "Compiler",   "Network"};
+  vector<pair<int, string>> composite_keys(node_count);
+  for (pair<int, string> &key : composite_keys) {
+    key.first = 10000000 + static_cast<int>(generator() % 90000000);
+    key.second = kSubjects[generator() % 8];
+  }
+
+  for (InsertMode mode : {InsertMode::kBottomUp, InsertMode::kTopDown}) {
+    runBenchmark<BasicRedBlackTree<int, EmptyPayload, IntKeyComparator>>(
+        "int", int_keys, mode);
+    runBenchmark<
+        BasicRedBlackTree<pair<int, string>, EmptyPayload, NodeKeyComparator>>(
+        "(sid, subject)", composite_keys, mode);
+  }
+  return 0;
+}
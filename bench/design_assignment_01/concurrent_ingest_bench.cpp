@@ -0,0 +1,121 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-06-15
+ *
+ * Description: Contention benchmark for multi-writer ingest. The same mix of
+ * inserts and "L" scans runs against the lock-free skiplist backend and a
+ * RedBlackTree behind one global mutex, at 1, 2, 4, ... writer threads.
+ * Usage: ./RBTConcurrentIngestBench [op_count] [max_threads] [scan_percent]
+ */
+#include "../../src/design_assignment_01/concurrent_registration_index.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+using namespace std;
+
+typedef chrono::steady_clock BenchClock;
+
+// One pre-generated operation: an insert, or an "L sid" scan.
+struct IngestOp {
+  bool is_scan;
+  int sid;
+  const string *subject;
+  int timestamp;
+};
+
+// RedBlackTree serialized by a single mutex: the baseline backend.
+class LockedRegistrationTree {
+public:
+  void run(const IngestOp &op) {
+    lock_guard<mutex> lock(tree_mutex);
+    if (op.is_scan)
+      tree.inquireAllSubjects(op.sid, response);
+    else
+      tree.inquireInsert(op.sid, *op.subject, "Name", 1, "01000000000",
+                         op.timestamp, response);
+    response.entries.clear();
+  }
+
+private:
+  mutex tree_mutex;
+  RedBlackTree tree;
+  QueryResponse response;
+};
+
+// Runs 'ops' split evenly over 'thread_count' threads; returns ops/s.
+template <typename RunOp>
+static double runThreads(const vector<IngestOp> &ops, int thread_count,
+                         RunOp run_op) {
+  vector<thread> writers;
+  const BenchClock::time_point start = BenchClock::now();
+  for (int t = 0; t < thread_count; t++) {
+    writers.emplace_back([&, t]() {
+      for (size_t i = t; i < ops.size(); i += thread_count)
+        run_op(ops[i], t);
+    });
+  }
+  for (thread &writer : writers)
+    writer.join();
+  const double seconds =
+      chrono::duration<double>(BenchClock::now() - start).count();
+  return static_cast<double>(ops.size()) / seconds;
+}
+
+int main(int argc, char **argv) {
+  const size_t op_count = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 400000;
+  const int max_threads = (argc > 2) ? atoi(argv[2]) : 32;
+  const int scan_percent = (argc > 3) ? atoi(argv[3]) : 10;
+
+  vector<string> subjects;
+  for (int i = 0; i < 64; i++)
+    subjects.push_back("Subject" + to_string(i));
+
+  // Roughly one key in four repeats, exercising the timestamp update path.
+  mt19937 generator(20250615);
+  const int sid_range = static_cast<int>(op_count / 48) + 1;
+  vector<IngestOp> ops(op_count);
+  for (IngestOp &op : ops) {
+    op.is_scan = static_cast<int>(generator() % 100) < scan_percent;
+    op.sid = 10000000 + static_cast<int>(generator() % sid_range);
+    op.subject = &subjects[generator() % subjects.size()];
+    op.timestamp = static_cast<int>(generator() % 1000000);
+  }
+
+  cout << "threads  skiplist(ops/s)  locked-rbt(ops/s)  hardware threads="
+       << thread::hardware_concurrency() << "\n";
+  for (int thread_count = 1; thread_count <= max_threads; thread_count *= 2) {
+    double skiplist_rate;
+    {
+      ConcurrentRegistrationIndex index(thread_count);
+      skiplist_rate = runThreads(
+          ops, thread_count, [&index](const IngestOp &op, int thread_id) {
+            vector<SubjectTimestampPair> listed;
+            if (op.is_scan)
+              index.inquireAllSubjects(op.sid, listed, thread_id);
+            else
+              index.inquireInsert(op.sid, *op.subject, "Name", 1,
+                                  "01000000000", op.timestamp, thread_id);
+          });
+    }
+    double locked_rate;
+    {
+      LockedRegistrationTree tree;
+      locked_rate =
+          runThreads(ops, thread_count,
+                     [&tree](const IngestOp &op, int) { tree.run(op); });
+    }
+    cout << thread_count << "  " << static_cast<long long>(skiplist_rate)
+         << "  " << static_cast<long long>(locked_rate) << "\n";
+  }
+  return 0;
+}
@@ -0,0 +1,107 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-06-16
+ *
+ * Description: Compares the std::string (sid, subject) comparator with the
+ * 16/32-byte inline subject keys, both as raw comparator calls on keys that
+ * share the sid and as BasicRedBlackTree insert/find.
+ * Usage: ./RBTInlineSubjectBench [key_count]
+ */
+#include "../../src/design_assignment_01/inline_subject_key.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+using namespace std;
+
+typedef chrono::steady_clock BenchClock;
+
+// Returns nanoseconds per operation since 'start' for 'count' operations.
+static double nanosPerOp(const BenchClock::time_point &start, size_t count) {
+  const double elapsed =
+      chrono::duration<double, nano>(BenchClock::now() - start).count();
+  return elapsed / static_cast<double>(count);
+}
+
+// Compares neighbouring keys over many rounds; the result sum keeps the
+// calls from being optimized away.
+template <typename Compare, typename Key>
+static double comparatorNanos(const vector<Key> &keys, int rounds, long &sum) {
+  const BenchClock::time_point start = BenchClock::now();
+  for (int round = 0; round < rounds; round++) {
+    for (size_t i = 1; i < keys.size(); i++)
+      sum += Compare::compare(keys[i - 1], keys[i]);
+  }
+  return nanosPerOp(start, (keys.size() - 1) * rounds);
+}
+
+// Inserts and then looks up every key, reporting ns/op for both phases.
+template <typename Compare, typename Key>
+static void runTree(const string &name, const vector<Key> &keys,
+                    double compare_ns) {
+  BasicRedBlackTree<Key, EmptyPayload, Compare> tree;
+  BenchClock::time_point start = BenchClock::now();
+  for (const Key &key : keys)
+    tree.insert(key, EmptyPayload());
+  const double insert_ns = nanosPerOp(start, keys.size());
+
+  size_t found = 0;
+  start = BenchClock::now();
+  for (const Key &key : keys)
+    found += (tree.find(key) != nullptr);
+  const double find_ns = nanosPerOp(start, keys.size());
+
+  cout << name << ": compare=" << compare_ns << " ns insert=" << insert_ns
+       << " ns/op find=" << find_ns << " ns/op (found " << found << ")\n";
+}
+
+int main(int argc, char **argv) {
+  const size_t key_count = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 1000000;
+  static const char *kSubjects[] = {"Algorithms", "Algorithm",  "Misaso",
+                                    "Mathmatics", "Math",       "Physics",
+                                    "Chemistry",  "Database",   "Compiler",
+                                    "Network",    "Networking", "Data"};
+  mt19937 generator(20250616);
+
+  // Few students so that most comparisons reach the subject.
+  vector<pair<int, string>> string_keys(key_count);
+  for (pair<int, string> &key : string_keys) {
+    key.first = 10000000 + static_cast<int>(generator() % (key_count / 8 + 1));
+    key.second = kSubjects[generator() % 12];
+  }
+  vector<pair<int, string>> same_sid_keys = string_keys;
+  for (pair<int, string> &key : same_sid_keys)
+    key.first = 12210795;
+
+  vector<InlineNodeKey16> keys16, same_sid16;
+  vector<InlineNodeKey32> keys32, same_sid32;
+  for (size_t i = 0; i < key_count; i++) {
+    keys16.emplace_back(string_keys[i].first,
+                        InlineSubject<16>(string_keys[i].second));
+    keys32.emplace_back(string_keys[i].first,
+                        InlineSubject<32>(string_keys[i].second));
+    same_sid16.emplace_back(12210795, InlineSubject<16>(string_keys[i].second));
+    same_sid32.emplace_back(12210795, InlineSubject<32>(string_keys[i].second));
+  }
+
+  long sum = 0;
+  const double string_ns =
+      comparatorNanos<NodeKeyComparator>(same_sid_keys, 10, sum);
+  const double inline16_ns =
+      comparatorNanos<InlineNodeKeyComparator<16>>(same_sid16, 10, sum);
+  const double inline32_ns =
+      comparatorNanos<InlineNodeKeyComparator<32>>(same_sid32, 10, sum);
+
+  runTree<NodeKeyComparator>("string", string_keys, string_ns);
+  runTree<InlineNodeKeyComparator<16>>("inline16", keys16, inline16_ns);
+  runTree<InlineNodeKeyComparator<32>>("inline32", keys32, inline32_ns);
+  cout << "(checksum " << sum << ")\n";
+  return 0;
+}
@@ -0,0 +1,70 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-06-09
+ *
+ * Description: Writes a random registration workload (I/L/C/M queries) in the
+ * input format of INHA_Algorithm_003, for throughput measurements.
+ * Usage: ./RBTQueryGenerator query_count [student_count] [seed] > queries.in
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+using namespace std;
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s query_count [student_count] [seed]\n", argv[0]);
+    return 1;
+  }
+  const long long query_count = atoll(argv[1]);
+  const int student_count = (argc > 2) ? atoi(argv[2]) : 1000000;
+  mt19937 generator((argc > 3) ? atoi(argv[3]) : 20250609);
+
+  // Subject catalog: short identifiers like the real course names.
+  vector<string> subjects;
+  static const char *kPrefixes[] = {"Algorithms", "Misaso",   "Mathmatics",
+                                    "Physics",    "Database", "Compiler",
+                                    "Network",    "Graphics"};
+  for (int i = 0; i < 256; i++) {
+    subjects.push_back(string(kPrefixes[i % 8]) + to_string(i / 8));
+  }
+
+  printf("%lld\n", query_count);
+  int timestamp = 1;
+  // Subjects are only queried after their first insertion.
+  vector<bool> subject_used(subjects.size(), false);
+  vector<int> used_subjects;
+  for (long long i = 0; i < query_count; i++) {
+    const int sid = 10000000 + static_cast<int>(generator() % student_count);
+    const unsigned int roll = generator() % 100;
+    if (roll < 50 || used_subjects.empty()) {
+      const int subject = generator() % subjects.size();
+      if (!subject_used[subject]) {
+        subject_used[subject] = true;
+        used_subjects.push_back(subject);
+      }
+      timestamp += 1 + generator() % 5;
+      printf("I %d %s Student%d %d 010%08d %d\n", sid,
+             subjects[subject].c_str(), sid % 1000, 1 + sid % 8,
+             sid % 100000000, timestamp);
+    } else if (roll < 70) {
+      printf("L %d\n", sid);
+    } else {
+      const string &subject =
+          subjects[used_subjects[generator() % used_subjects.size()]];
+      if (roll < 80)
+        printf("C %s\n", subject.c_str());
+      else
+        printf("M %s %d\n", subject.c_str(),
+               static_cast<int>(1 + generator() % 8));
+    }
+  }
+  return 0;
+}
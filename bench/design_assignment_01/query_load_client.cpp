@@ -0,0 +1,166 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-06-11
+ *
+ * Description: Load generator for "INHA_Algorithm_003 --server PATH". Opens
+ * several connections, pipelines random I/L/C/M lines in windows of W
+ * requests and reports requests/s and latency percentiles.
+ * Usage: ./RBTQueryLoadClient PATH [connections] [requests_per_connection]
+ *                             [window]
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+using namespace std;
+
+typedef chrono::steady_clock LoadClock;
+
+// Connects to the server socket, or returns -1.
+static int connectTo(const string &socket_path) {
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  sockaddr_un address;
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+  if (fd < 0 ||
+      connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) <
+          0) {
+    perror("connect");
+    if (fd >= 0)
+      close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+// Builds one random query line. A C/M line for a subject nobody inserted yet
+// is still answered with one (error) line, so the line count stays exact.
+static string makeQuery(mt19937 &generator, int connection) {
+  static const char *kSubjects[] = {"Algorithms", "Misaso",   "Mathmatics",
+                                    "Physics",    "Database", "Compiler",
+                                    "Network",    "Graphics"};
+  const int sid = 10000000 + static_cast<int>(generator() % 100000);
+  const unsigned int roll = generator() % 100;
+  // 256 catalog entries such as "Algorithms17".
+  const unsigned int subject_index = generator() % 256;
+  char subject[32];
+  snprintf(subject, sizeof(subject), "%s%u", kSubjects[subject_index % 8],
+           subject_index / 8);
+  char line[128];
+  if (roll < 50)
+    snprintf(line, sizeof(line), "I %d %s Load%d 3 01012345678 %u\n", sid,
+             subject, connection, static_cast<unsigned int>(generator() >> 1));
+  else if (roll < 70)
+    snprintf(line, sizeof(line), "L %d\n", sid);
+  else if (roll < 80)
+    snprintf(line, sizeof(line), "C %s\n", subject);
+  else
+    snprintf(line, sizeof(line), "M %s %u\n", subject,
+             static_cast<unsigned int>(1 + generator() % 8));
+  return line;
+}
+
+// Runs one connection and appends every request latency (in microseconds).
+static void runConnection(const string &socket_path, int connection,
+                          long requests, int window,
+                          vector<double> &latencies) {
+  int fd = connectTo(socket_path);
+  if (fd < 0)
+    return;
+  mt19937 generator(1000 + connection);
+  vector<char> chunk(1 << 16);
+  for (long sent = 0; sent < requests; sent += window) {
+    const long count = min<long>(window, requests - sent);
+    string batch;
+    for (long i = 0; i < count; i++)
+      batch += makeQuery(generator, connection);
+
+    const LoadClock::time_point start = LoadClock::now();
+    for (size_t written = 0; written < batch.size();) {
+      ssize_t length =
+          write(fd, batch.data() + written, batch.size() - written);
+      if (length <= 0) {
+        close(fd);
+        return;
+      }
+      written += length;
+    }
+
+    // Each request is answered by exactly one line.
+    long received = 0;
+    while (received < count) {
+      ssize_t length = read(fd, chunk.data(), chunk.size());
+      if (length <= 0) {
+        close(fd);
+        return;
+      }
+      const double elapsed =
+          chrono::duration<double, micro>(LoadClock::now() - start).count();
+      for (ssize_t i = 0; i < length; i++) {
+        if (chunk[i] == '\n') {
+          latencies.push_back(elapsed);
+          received++;
+        }
+      }
+    }
+  }
+  close(fd);
+}
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    fprintf(stderr,
+            "Usage: %s PATH [connections] [requests_per_connection] "
+            "[window]\n",
+            argv[0]);
+    return 1;
+  }
+  const string socket_path = argv[1];
+  const int connections = (argc > 2) ? atoi(argv[2]) : 8;
+  const long requests = (argc > 3) ? atol(argv[3]) : 100000;
+  const int window = (argc > 4) ? atoi(argv[4]) : 64;
+
+  vector<vector<double>> latencies(connections);
+  vector<thread> threads;
+  const LoadClock::time_point start = LoadClock::now();
+  for (int i = 0; i < connections; i++)
+    threads.emplace_back(runConnection, socket_path, i, requests, window,
+                         ref(latencies[i]));
+  for (thread &worker : threads)
+    worker.join();
+  const double elapsed =
+      chrono::duration<double>(LoadClock::now() - start).count();
+
+  vector<double> all;
+  for (const vector<double> &connection_latencies : latencies)
+    all.insert(all.end(), connection_latencies.begin(),
+               connection_latencies.end());
+  if (all.empty()) {
+    fprintf(stderr, "No responses received\n");
+    return 1;
+  }
+  sort(all.begin(), all.end());
+  auto percentile = [&](double p) {
+    return all[min(all.size() - 1, static_cast<size_t>(p * all.size()))];
+  };
+  printf("connections=%d window=%d requests=%zu\n", connections, window,
+         all.size());
+  printf("throughput=%.0f req/s\n", all.size() / elapsed);
+  printf("latency p50=%.1f us p99=%.1f us p99.9=%.1f us max=%.1f us\n",
+         percentile(0.50), percentile(0.99), percentile(0.999), all.back());
+  return 0;
+}
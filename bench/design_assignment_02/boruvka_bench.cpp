@@ -0,0 +1,108 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-06-25
+ *
+ * Description: Scaling of the parallel Borůvka engine from 1 to max_threads
+ * threads (doubling) on one random connected network with 5 roads per
+ * city, next to single-run eager Prim and Kruskal. Every run must select
+ * the same total.
+ * Usage: ./PrimBoruvkaBench [road_count] [max_threads]
+ */
+#include "../../src/design_assignment_02/boruvka_mst.hpp"
+#include "../../src/design_assignment_02/kruskal_mst.hpp"
+#include "../../src/design_assignment_02/prim_mst.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+using namespace std;
+
+typedef chrono::steady_clock BenchClock;
+
+// Returns milliseconds since 'start'.
+static double millisSince(const BenchClock::time_point &start) {
+  return chrono::duration<double, milli>(BenchClock::now() - start).count();
+}
+
+// Builds a random connected network of 'city_count' cities and 'road_count'
+// roads (at least city_count - 1).
+static void buildRandomGraph(size_t city_count, size_t road_count,
+                             RoadGraph &graph) {
+  mt19937 generator(20250625);
+  RoadGraphBuilder builder;
+  vector<string> names(city_count);
+  for (size_t i = 0; i < city_count; i++) {
+    names[i] = "City" + to_string(generator() % 100000) + "_" + to_string(i);
+    builder.addCity(names[i], static_cast<int>(generator() % 2000));
+  }
+  auto addRoad = [&](size_t first, size_t second) {
+    char timestamp[8];
+    snprintf(timestamp, sizeof(timestamp), "%04u-%02u",
+             1985 + static_cast<unsigned>(generator() % 40),
+             1 + static_cast<unsigned>(generator() % 12));
+    builder.addRoad(names[first], names[second],
+                    static_cast<int>(1 + generator() % 600) * 10, timestamp);
+  };
+  for (size_t i = 1; i < city_count; i++)
+    addRoad(i, generator() % i);
+  for (size_t i = city_count - 1; i < road_count; i++)
+    addRoad(generator() % city_count, generator() % city_count);
+  builder.build(graph);
+}
+
+int main(int argc, char **argv) {
+  const size_t road_count =
+      (argc > 1) ? strtoul(argv[1], nullptr, 10) : 4000000;
+  const int max_threads = (argc > 2) ? atoi(argv[2]) : 64;
+
+  RoadGraph graph;
+  buildRandomGraph(road_count / 5 + 1, road_count, graph);
+  cout << "graph: cities=" << graph.cityCount()
+       << " roads=" << graph.bridgeCount()
+       << " hardware_threads=" << defaultThreadCount() << "\n";
+
+  // A stream without a buffer drops every line, so output is not measured.
+  ostream null_out(nullptr);
+
+  MST prim(graph, null_out);
+  prim.setPrimMode(PrimMode::kEager);
+  BenchClock::time_point start = BenchClock::now();
+  prim.setStartingNode(graph.cityName(0));
+  prim.initializeMST();
+  cout << "prim eager: " << millisSince(start)
+       << " ms total=" << prim.totalLength() << "\n";
+
+  KruskalMST kruskal(graph, null_out);
+  kruskal.setThreadCount(1);
+  start = BenchClock::now();
+  kruskal.initializeMST();
+  cout << "kruskal threads=1: " << millisSince(start)
+       << " ms total=" << kruskal.totalLength() << "\n";
+
+  bool same_total = (kruskal.totalLength() == prim.totalLength());
+  double single_thread = 0;
+  for (int threads = 1; threads <= max_threads; threads *= 2) {
+    BoruvkaMST boruvka(graph, null_out);
+    boruvka.setThreadCount(threads);
+    start = BenchClock::now();
+    boruvka.initializeMST();
+    const double elapsed = millisSince(start);
+    if (threads == 1)
+      single_thread = elapsed;
+    cout << "boruvka threads=" << threads << ": " << elapsed
+         << " ms speedup=" << single_thread / elapsed
+         << " rounds=" << boruvka.getRoundCount()
+         << " total=" << boruvka.totalLength() << "\n";
+    same_total = same_total && (boruvka.totalLength() == prim.totalLength());
+  }
+  cout << "same total: " << (same_total ? "yes" : "NO") << "\n";
+  return same_total ? 0 : 1;
+}
@@ -0,0 +1,113 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-07-03
+ *
+ * Description: Measures binary-heap push/pop throughput over every bridge of a
+ * random network, comparing bridges field by field (timestamp and city names
+ * as strings) against one compare of the packed priority key. Both orders
+ * are checked to pop the same sequence.
+ * Usage: ./PrimBridgeKeyBench [road_count]
+ */
+#include "../../src/design_assignment_02/prim_mst.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+using namespace std;
+
+typedef chrono::steady_clock BenchClock;
+
+// The comparator before packing: timestamp and city names as strings.
+struct FieldBridgeComparator {
+  const RoadGraph *graph;
+
+  bool operator()(BridgeId a, BridgeId b) const {
+    const string &a_timestamp = graph->timestampName(graph->timestamp(a));
+    const string &b_timestamp = graph->timestampName(graph->timestamp(b));
+    if (a_timestamp != b_timestamp)
+      return a_timestamp > b_timestamp;
+    if (graph->roadLength(a) != graph->roadLength(b))
+      return graph->roadLength(a) > graph->roadLength(b);
+    if (graph->elevationDifference(a) != graph->elevationDifference(b))
+      return graph->elevationDifference(a) > graph->elevationDifference(b);
+    const string &a_earlier = graph->cityName(graph->earlierCity(a));
+    const string &b_earlier = graph->cityName(graph->earlierCity(b));
+    if (a_earlier != b_earlier)
+      return a_earlier > b_earlier;
+    return graph->cityName(graph->laterCity(a)) >
+           graph->cityName(graph->laterCity(b));
+  }
+};
+
+// Pushes every bridge in 'bridges' order, then pops them all. Returns the
+// pop order and reports ns per heap operation.
+template <typename Compare>
+static BridgeHeap runHeap(const string &name, const BridgeHeap &bridges,
+                          Compare compare) {
+  BridgeHeap heap;
+  heap.reserve(bridges.size());
+  BridgeHeap popped;
+  popped.reserve(bridges.size());
+
+  BenchClock::time_point start = BenchClock::now();
+  for (BridgeId bridge : bridges) {
+    heap.push_back(bridge);
+    push_heap(heap.begin(), heap.end(), compare);
+  }
+  while (!heap.empty()) {
+    popped.push_back(heap.front());
+    pop_heap(heap.begin(), heap.end(), compare);
+    heap.pop_back();
+  }
+  const double elapsed =
+      chrono::duration<double, nano>(BenchClock::now() - start).count();
+
+  cout << name << ": bridges=" << bridges.size()
+       << " push+pop=" << elapsed / (2.0 * bridges.size()) << " ns/op\n";
+  return popped;
+}
+
+int main(int argc, char **argv) {
+  const size_t road_count =
+      (argc > 1) ? strtoul(argv[1], nullptr, 10) : 4000000;
+  const size_t city_count = road_count / 4 + 2;
+  mt19937 generator(20250623);
+
+  RoadGraphBuilder builder;
+  vector<string> names(city_count);
+  for (size_t i = 0; i < city_count; i++) {
+    names[i] = "City" + to_string(generator() % 100000) + "_" + to_string(i);
+    builder.addCity(names[i], static_cast<int>(generator() % 2000));
+  }
+  for (size_t i = 0; i < road_count; i++) {
+    char timestamp[8];
+    snprintf(timestamp, sizeof(timestamp), "%04u-%02u",
+             1985 + static_cast<unsigned>(generator() % 40),
+             1 + static_cast<unsigned>(generator() % 12));
+    builder.addRoad(names[generator() % city_count],
+                    names[generator() % city_count],
+                    static_cast<int>(1 + generator() % 600) * 10, timestamp);
+  }
+  RoadGraph graph;
+  builder.build(graph);
+
+  BridgeHeap bridges(graph.bridgeCount());
+  for (BridgeId id = 0; id < graph.bridgeCount(); id++)
+    bridges[id] = id;
+
+  BridgeHeap field_order =
+      runHeap("field compare", bridges, FieldBridgeComparator{&graph});
+  BridgeHeap key_order =
+      runHeap("packed key", bridges, BridgeComparator(graph, cout));
+  cout << "same pop order: " << ((field_order == key_order) ? "yes" : "NO")
+       << "\n";
+  return (field_order == key_order) ? 0 : 1;
+}
@@ -0,0 +1,99 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-06-30
+ *
+ * Description: Memory per bridge and MST build time of the bridge storage
+ * on one large random connected network, 5 roads per city by default.
+ * Reports the arena columns plus CSR entries per bridge, the candidate
+ * heap's peak bytes per bridge, and the lazy and eager initializeMST()
+ * times.
+ * Usage: ./PrimBridgeStorageBench [road_count]
+ */
+#include "../../src/design_assignment_02/prim_mst.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+using namespace std;
+
+typedef chrono::steady_clock BenchClock;
+
+// Returns milliseconds since 'start'.
+static double millisSince(const BenchClock::time_point &start) {
+  return chrono::duration<double, milli>(BenchClock::now() - start).count();
+}
+
+// Builds a random connected network of 'city_count' cities and 'road_count'
+// roads (at least city_count - 1).
+static void buildRandomGraph(size_t city_count, size_t road_count,
+                             RoadGraph &graph) {
+  mt19937 generator(20250630);
+  RoadGraphBuilder builder;
+  vector<string> names(city_count);
+  for (size_t i = 0; i < city_count; i++) {
+    names[i] = "City" + to_string(generator() % 100000) + "_" + to_string(i);
+    builder.addCity(names[i], static_cast<int>(generator() % 2000));
+  }
+  auto addRoad = [&](size_t first, size_t second) {
+    char timestamp[8];
+    snprintf(timestamp, sizeof(timestamp), "%04u-%02u",
+             1985 + static_cast<unsigned>(generator() % 40),
+             1 + static_cast<unsigned>(generator() % 12));
+    builder.addRoad(names[first], names[second],
+                    static_cast<int>(1 + generator() % 600) * 10, timestamp);
+  };
+  for (size_t i = 1; i < city_count; i++)
+    addRoad(i, generator() % i);
+  for (size_t i = city_count - 1; i < road_count; i++)
+    addRoad(generator() % city_count, generator() % city_count);
+  builder.build(graph);
+}
+
+int main(int argc, char **argv) {
+  const size_t road_count =
+      (argc > 1) ? strtoul(argv[1], nullptr, 10) : 10000000;
+
+  BenchClock::time_point start = BenchClock::now();
+  RoadGraph graph;
+  buildRandomGraph(road_count / 5 + 1, road_count, graph);
+  const double bridge_count = static_cast<double>(graph.bridgeCount());
+  cout << "graph: cities=" << graph.cityCount()
+       << " roads=" << graph.bridgeCount() << " build=" << millisSince(start)
+       << " ms\n";
+  cout << "bridge bytes: columns=" << BridgeColumns::kBytesPerBridge
+       << " columns+csr=" << graph.bridgeBytes() / bridge_count
+       << " per bridge\n";
+
+  // A stream without a buffer drops every line, so output is not measured.
+  ostream null_out(nullptr);
+
+  for (PrimMode mode : {PrimMode::kLazy, PrimMode::kEager}) {
+    MST prim(graph, null_out);
+    prim.setPrimMode(mode);
+    start = BenchClock::now();
+    prim.setStartingNode(graph.cityName(0));
+    prim.initializeMST();
+    const double elapsed = millisSince(start);
+
+    // The lazy heap holds one BridgeId per entry. The eager heap holds a
+    // BridgeId and a heap position per city, plus one city ID per entry.
+    const double heap_bytes =
+        (mode == PrimMode::kLazy)
+            ? prim.peakHeapSize() * sizeof(BridgeId)
+            : graph.cityCount() * (sizeof(BridgeId) + sizeof(uint32_t)) +
+                  prim.peakHeapSize() * sizeof(CityId);
+    cout << ((mode == PrimMode::kEager) ? "prim eager" : "prim lazy") << ": "
+         << elapsed << " ms peak heap=" << prim.peakHeapSize() << " ("
+         << heap_bytes / bridge_count
+         << " bytes per bridge) total=" << prim.totalLength() << "\n";
+  }
+  return 0;
+}
@@ -0,0 +1,135 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-06-27
+ *
+ * Description: Times bridge insertions into the dynamic MST against
+ * rebuilding the tree with Kruskal's algorithm, on a random connected
+ * network with 5 roads per city by default. After the insertions, checks
+ * that the dynamic total equals a rebuild over every road.
+ * Usage: ./PrimDynamicMSTBench [road_count] [insertion_count]
+ */
+#include "../../src/design_assignment_02/dynamic_mst.hpp"
+#include "../../src/design_assignment_02/kruskal_mst.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+using namespace std;
+
+typedef chrono::steady_clock BenchClock;
+
+// Returns milliseconds since 'start'.
+static double millisSince(const BenchClock::time_point &start) {
+  return chrono::duration<double, milli>(BenchClock::now() - start).count();
+}
+
+// A road of the random network, by city index.
+struct BenchRoad {
+  size_t first, second;
+  int length;
+  string timestamp;
+};
+
+// Random connected network: 'city_count' cities and 'road_count' roads (at
+// least city_count - 1), followed by 'insertion_count' more roads.
+static void buildRandomRoads(size_t city_count, size_t road_count,
+                             size_t insertion_count, vector<string> &names,
+                             vector<int> &elevations,
+                             vector<BenchRoad> &roads) {
+  mt19937 generator(20250627);
+  names.resize(city_count);
+  elevations.resize(city_count);
+  for (size_t i = 0; i < city_count; i++) {
+    names[i] = "City" + to_string(generator() % 100000) + "_" + to_string(i);
+    elevations[i] = static_cast<int>(generator() % 2000);
+  }
+  auto addRoad = [&](size_t first, size_t second) {
+    char timestamp[8];
+    snprintf(timestamp, sizeof(timestamp), "%04u-%02u",
+             1985 + static_cast<unsigned>(generator() % 40),
+             1 + static_cast<unsigned>(generator() % 12));
+    roads.push_back(BenchRoad{first, second,
+                              static_cast<int>(1 + generator() % 600) * 10,
+                              timestamp});
+  };
+  for (size_t i = 1; i < city_count; i++)
+    addRoad(i, generator() % i);
+  for (size_t i = city_count - 1; i < road_count + insertion_count; i++)
+    addRoad(generator() % city_count, generator() % city_count);
+}
+
+// Builds the graph of every city and the first 'road_count' roads.
+static void buildGraph(const vector<string> &names,
+                       const vector<int> &elevations,
+                       const vector<BenchRoad> &roads, size_t road_count,
+                       RoadGraph &graph) {
+  RoadGraphBuilder builder;
+  for (size_t i = 0; i < names.size(); i++)
+    builder.addCity(names[i], elevations[i]);
+  for (size_t i = 0; i < road_count; i++)
+    builder.addRoad(names[roads[i].first], names[roads[i].second],
+                    roads[i].length, roads[i].timestamp);
+  builder.build(graph);
+}
+
+int main(int argc, char **argv) {
+  const size_t road_count =
+      (argc > 1) ? strtoul(argv[1], nullptr, 10) : 1000000;
+  const size_t insertion_count =
+      (argc > 2) ? strtoul(argv[2], nullptr, 10) : 100000;
+
+  vector<string> names;
+  vector<int> elevations;
+  vector<BenchRoad> roads;
+  buildRandomRoads(road_count / 5 + 1, road_count, insertion_count, names,
+                   elevations, roads);
+  RoadGraph graph;
+  buildGraph(names, elevations, roads, road_count, graph);
+  cout << "graph: cities=" << graph.cityCount()
+       << " roads=" << graph.bridgeCount() << "\n";
+
+  // A stream without a buffer drops every line, so output is not measured.
+  ostream null_out(nullptr);
+
+  DynamicMST dynamic(graph, null_out);
+  BenchClock::time_point start = BenchClock::now();
+  dynamic.initializeMST(1);
+  cout << "dynamic initialize: " << millisSince(start) << " ms\n";
+
+  size_t swapped = 0, linked = 0;
+  start = BenchClock::now();
+  for (size_t i = road_count; i < roads.size(); i++) {
+    BridgeInsertion result =
+        dynamic.addBridge(names[roads[i].first], names[roads[i].second],
+                          roads[i].length, roads[i].timestamp);
+    swapped += (result == BridgeInsertion::kSwapped);
+    linked += (result == BridgeInsertion::kLinked);
+  }
+  const double insert_ms = millisSince(start);
+  cout << "insertions=" << insertion_count << " swapped=" << swapped
+       << " linked=" << linked << ": " << insert_ms << " ms ("
+       << (insertion_count ? insert_ms * 1000.0 / insertion_count : 0.0)
+       << " us each)\n";
+
+  RoadGraph rebuilt;
+  buildGraph(names, elevations, roads, roads.size(), rebuilt);
+  KruskalMST kruskal(rebuilt, null_out);
+  kruskal.setThreadCount(1);
+  start = BenchClock::now();
+  kruskal.initializeMST();
+  cout << "kruskal rebuild: " << millisSince(start)
+       << " ms total=" << kruskal.totalLength() << "\n";
+
+  const bool same_total = (dynamic.totalLength() == kruskal.totalLength());
+  cout << "dynamic total=" << dynamic.totalLength()
+       << " same total: " << (same_total ? "yes" : "NO") << "\n";
+  return same_total ? 0 : 1;
+}
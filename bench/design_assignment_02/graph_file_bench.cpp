@@ -0,0 +1,142 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-07-01
+ *
+ * Description: Time to get one large random network into a RoadGraph, from
+ * the text input format (parse, intern and build) and from the binary
+ * road-network file (map and point into it). Both files are written to the
+ * temporary directory first; the bench checks that Prim's algorithm gives
+ * the same total on both graphs.
+ * Usage: ./PrimGraphFileBench [road_count] [directory]
+ */
+#include "../../src/design_assignment_02/prim_mst.hpp"
+#include "../../src/design_assignment_02/road_graph_file.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+using namespace std;
+
+typedef chrono::steady_clock BenchClock;
+
+// Returns milliseconds since 'start'.
+static double millisSince(const BenchClock::time_point &start) {
+  return chrono::duration<double, milli>(BenchClock::now() - start).count();
+}
+
+// Writes a random connected network of 'city_count' cities and 'road_count'
+// roads (at least city_count - 1) to 'path' in the text input format.
+static void writeRandomNetwork(size_t city_count, size_t road_count,
+                               const string &path) {
+  mt19937 generator(20250701);
+  ofstream out(path);
+  vector<string> names(city_count);
+  out << city_count << "\n";
+  for (size_t i = 0; i < city_count; i++) {
+    names[i] = "City" + to_string(generator() % 100000) + "_" + to_string(i);
+    out << names[i] << " " << generator() % 2000 << "\n";
+  }
+  out << road_count << "\n";
+  auto writeRoad = [&](size_t first, size_t second) {
+    char timestamp[8];
+    snprintf(timestamp, sizeof(timestamp), "%04u-%02u",
+             1985 + static_cast<unsigned>(generator() % 40),
+             1 + static_cast<unsigned>(generator() % 12));
+    out << names[first] << " " << names[second] << " "
+        << (1 + generator() % 600) * 10 << " " << timestamp << "\n";
+  };
+  for (size_t i = 1; i < city_count; i++)
+    writeRoad(i, generator() % i);
+  for (size_t i = city_count - 1; i < road_count; i++)
+    writeRoad(generator() % city_count, generator() % city_count);
+  out << names[0] << "\n";
+}
+
+// Reads a text network the way the program does. Returns the starting city.
+static string readTextNetwork(const string &path, RoadGraph &graph) {
+  ifstream in(path);
+  RoadGraphBuilder builder;
+  int count;
+  in >> count;
+  while (count--) {
+    string city;
+    int elevation;
+    in >> city >> elevation;
+    builder.addCity(city, elevation);
+  }
+  in >> count;
+  while (count--) {
+    string first_city, second_city, timestamp;
+    int road_length;
+    in >> first_city >> second_city >> road_length >> timestamp;
+    builder.addRoad(first_city, second_city, road_length, timestamp);
+  }
+  string starting_city;
+  in >> starting_city;
+  builder.build(graph);
+  return starting_city;
+}
+
+// Returns the size of the file at 'path' in MB.
+static double fileMegabytes(const string &path) {
+  ifstream in(path, ios::binary | ios::ate);
+  return static_cast<double>(in.tellg()) / (1 << 20);
+}
+
+// Total length of Prim's tree from 'starting_city'.
+static long long primTotal(const RoadGraph &graph,
+                           const string &starting_city) {
+  // A stream without a buffer drops every line, so output is not measured.
+  ostream null_out(nullptr);
+  MST prim(graph, null_out);
+  prim.setPrimMode(PrimMode::kEager);
+  prim.setStartingNode(starting_city);
+  prim.initializeMST();
+  return prim.totalLength();
+}
+
+int main(int argc, char **argv) {
+  const size_t road_count =
+      (argc > 1) ? strtoul(argv[1], nullptr, 10) : 4000000;
+  const string directory = (argc > 2) ? argv[2] : "/tmp";
+  const string text_path = directory + "/prim_graph_file_bench.txt";
+  const string binary_path = directory + "/prim_graph_file_bench.bin";
+  writeRandomNetwork(road_count / 5 + 1, road_count, text_path);
+
+  BenchClock::time_point start = BenchClock::now();
+  RoadGraph text_graph;
+  const string starting_city = readTextNetwork(text_path, text_graph);
+  cout << "text: " << millisSince(start) << " ms (" << fileMegabytes(text_path)
+       << " MB) cities=" << text_graph.cityCount()
+       << " roads=" << text_graph.bridgeCount() << "\n";
+
+  if (!RoadGraphFile::write(text_graph, binary_path)) {
+    cerr << "cannot write " << binary_path << "\n";
+    return 1;
+  }
+  start = BenchClock::now();
+  RoadGraph file_graph;
+  if (!RoadGraphFile::load(binary_path, file_graph)) {
+    cerr << "cannot load " << binary_path << "\n";
+    return 1;
+  }
+  cout << "binary: " << millisSince(start) << " ms ("
+       << fileMegabytes(binary_path) << " MB)\n";
+
+  const long long text_total = primTotal(text_graph, starting_city);
+  const long long file_total = primTotal(file_graph, starting_city);
+  cout << "same total: " << ((text_total == file_total) ? "yes" : "NO")
+       << "\n";
+  remove(text_path.c_str());
+  remove(binary_path.c_str());
+  return (text_total == file_total) ? 0 : 1;
+}
@@ -0,0 +1,105 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-06-28
+ *
+ * Description: Times fresh lazy Prim runs against cached-forest queries
+ * for several starting cities on one large random connected network, 5
+ * roads per city by default, and checks that both print the same bytes.
+ * Usage: ./PrimMultiStartBench [road_count] [start_count]
+ */
+#include "../../src/design_assignment_02/cached_mst.hpp"
+#include "../../src/design_assignment_02/prim_mst.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+using namespace std;
+
+typedef chrono::steady_clock BenchClock;
+
+// Returns milliseconds since 'start'.
+static double millisSince(const BenchClock::time_point &start) {
+  return chrono::duration<double, milli>(BenchClock::now() - start).count();
+}
+
+// Builds a random connected network of 'city_count' cities and 'road_count'
+// roads (at least city_count - 1).
+static void buildRandomGraph(size_t city_count, size_t road_count,
+                             RoadGraph &graph) {
+  mt19937 generator(20250628);
+  RoadGraphBuilder builder;
+  vector<string> names(city_count);
+  for (size_t i = 0; i < city_count; i++) {
+    names[i] = "City" + to_string(generator() % 100000) + "_" + to_string(i);
+    builder.addCity(names[i], static_cast<int>(generator() % 2000));
+  }
+  auto addRoad = [&](size_t first, size_t second) {
+    char timestamp[8];
+    snprintf(timestamp, sizeof(timestamp), "%04u-%02u",
+             1985 + static_cast<unsigned>(generator() % 40),
+             1 + static_cast<unsigned>(generator() % 12));
+    builder.addRoad(names[first], names[second],
+                    static_cast<int>(1 + generator() % 600) * 10, timestamp);
+  };
+  for (size_t i = 1; i < city_count; i++)
+    addRoad(i, generator() % i);
+  for (size_t i = city_count - 1; i < road_count; i++)
+    addRoad(generator() % city_count, generator() % city_count);
+  builder.build(graph);
+}
+
+int main(int argc, char **argv) {
+  const size_t road_count =
+      (argc > 1) ? strtoul(argv[1], nullptr, 10) : 1000000;
+  const size_t start_count = (argc > 2) ? strtoul(argv[2], nullptr, 10) : 5;
+
+  BenchClock::time_point start = BenchClock::now();
+  RoadGraph graph;
+  buildRandomGraph(road_count / 5 + 1, road_count, graph);
+  cout << "graph: cities=" << graph.cityCount()
+       << " roads=" << graph.bridgeCount() << " build=" << millisSince(start)
+       << " ms\n";
+
+  vector<string> starts;
+  for (size_t i = 0; i < start_count; i++)
+    starts.push_back(graph.cityName(i * graph.cityCount() / start_count));
+
+  // Both sides print into memory so the outputs can be compared.
+  ostringstream fresh_out;
+  start = BenchClock::now();
+  for (const string &starting_city : starts) {
+    MST prim(graph, fresh_out);
+    prim.setStartingNode(starting_city);
+    prim.initializeMST();
+    prim.printTotalElevationSum();
+    prim.printAllBridges();
+  }
+  const double fresh_ms = millisSince(start);
+  cout << "fresh prim: " << fresh_ms << " ms ("
+       << fresh_ms / start_count << " ms per start)\n";
+
+  ostringstream cached_out;
+  CachedMST cached(graph, cached_out);
+  start = BenchClock::now();
+  cached.initializeMST();
+  cout << "cached forest build: " << millisSince(start) << " ms\n";
+  start = BenchClock::now();
+  for (const string &starting_city : starts)
+    cached.printFromStart(starting_city);
+  const double cached_ms = millisSince(start);
+  cout << "cached queries: " << cached_ms << " ms ("
+       << cached_ms / start_count << " ms per start)\n";
+
+  const bool same_output = (cached_out.str() == fresh_out.str());
+  cout << "same output: " << (same_output ? "yes" : "NO") << "\n";
+  return same_output ? 0 : 1;
+}
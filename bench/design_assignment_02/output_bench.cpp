@@ -0,0 +1,121 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-07-02
+ *
+ * Description: Time to print the bridge report of a large spanning tree,
+ * one operator<< chain and endl per line against LineWriter into a
+ * BulkOutputBuffer. Both reports go to the same file and are checked to be
+ * byte-identical.
+ * Usage: ./PrimOutputBench [city_count] [file]
+ */
+#include "../../src/design_assignment_02/kruskal_mst.hpp"
+#include "../../src/design_assignment_02/output_buffer.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+using namespace std;
+
+typedef chrono::steady_clock BenchClock;
+
+// Returns milliseconds since 'start'.
+static double millisSince(const BenchClock::time_point &start) {
+  return chrono::duration<double, milli>(BenchClock::now() - start).count();
+}
+
+// Builds a random connected network of 'city_count' cities and 'road_count'
+// roads (at least city_count - 1).
+static void buildRandomGraph(size_t city_count, size_t road_count,
+                             RoadGraph &graph) {
+  mt19937 generator(20250702);
+  RoadGraphBuilder builder;
+  vector<string> names(city_count);
+  for (size_t i = 0; i < city_count; i++) {
+    names[i] = "City" + to_string(generator() % 100000) + "_" + to_string(i);
+    builder.addCity(names[i], static_cast<int>(generator() % 2000));
+  }
+  auto addRoad = [&](size_t first, size_t second) {
+    char timestamp[8];
+    snprintf(timestamp, sizeof(timestamp), "%04u-%02u",
+             1985 + static_cast<unsigned>(generator() % 40),
+             1 + static_cast<unsigned>(generator() % 12));
+    builder.addRoad(names[first], names[second],
+                    static_cast<int>(1 + generator() % 600) * 10, timestamp);
+  };
+  for (size_t i = 1; i < city_count; i++)
+    addRoad(i, generator() % i);
+  for (size_t i = city_count - 1; i < road_count; i++)
+    addRoad(generator() % city_count, generator() % city_count);
+  builder.build(graph);
+}
+
+// The bridge report before bulk output: a flush after every line.
+static void printWithEndl(const RoadGraph &graph, const BridgeHeap &bridges,
+                          ostream &out) {
+  for (BridgeId b : bridges) {
+    out << graph.timestampName(graph.timestamp(b)) << " "
+        << graph.cityName(graph.earlierCity(b)) << " "
+        << graph.cityName(graph.laterCity(b)) << " " << graph.roadLength(b)
+        << endl;
+  }
+}
+
+// Returns the contents of the file at 'path'.
+static string readFile(const string &path) {
+  ifstream in(path, ios::binary);
+  ostringstream contents;
+  contents << in.rdbuf();
+  return contents.str();
+}
+
+int main(int argc, char **argv) {
+  const size_t city_count =
+      (argc > 1) ? strtoul(argv[1], nullptr, 10) : 1000000;
+  const string path = (argc > 2) ? argv[2] : "/tmp/prim_output_bench.txt";
+
+  RoadGraph graph;
+  buildRandomGraph(city_count, 2 * city_count, graph);
+
+  // The report stream has no buffer until one is attached, so the first
+  // report, which sorts the bridges, is dropped.
+  ostream report(nullptr);
+  KruskalMST kruskal(graph, report);
+  kruskal.initializeMST();
+  kruskal.printAllBridges();
+  cout << "tree: bridges=" << kruskal.bridges().size() << "\n";
+
+  BenchClock::time_point start = BenchClock::now();
+  {
+    ofstream out(path, ios::binary | ios::trunc);
+    printWithEndl(graph, kruskal.bridges(), out);
+  }
+  cout << "endl per line: " << millisSince(start) << " ms\n";
+  const string endl_report = readFile(path);
+
+  // The bridges are already sorted, so printAllBridges() is mostly output.
+  start = BenchClock::now();
+  {
+    ofstream out(path, ios::binary | ios::trunc);
+    report.rdbuf(out.rdbuf());
+    BulkOutputBuffer buffer(report);
+    kruskal.printAllBridges();
+  }
+  report.rdbuf(nullptr);
+  cout << "bulk buffer: " << millisSince(start) << " ms\n";
+  const string bulk_report = readFile(path);
+  remove(path.c_str());
+
+  cout << "same report: " << ((endl_report == bulk_report) ? "yes" : "NO")
+       << "\n";
+  return (endl_report == bulk_report) ? 0 : 1;
+}
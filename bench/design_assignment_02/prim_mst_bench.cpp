@@ -0,0 +1,87 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-06-22
+ *
+ * Description: Compares lazy and eager Prim on a sparse network (4 roads per
+ * city) and a dense one (about a third of all city pairs connected),
+ * reporting the MST build time and the largest candidate heap.
+ * Usage: ./PrimMSTBench [sparse_city_count] [dense_city_count]
+ */
+#include "../../src/design_assignment_02/prim_mst.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+using namespace std;
+
+typedef chrono::steady_clock BenchClock;
+
+// Builds a random connected network of 'city_count' cities and 'road_count'
+// roads (at least city_count - 1).
+static void buildRandomGraph(size_t city_count, size_t road_count,
+                             RoadGraph &graph) {
+  mt19937 generator(20250622);
+  RoadGraphBuilder builder;
+  vector<string> names(city_count);
+  for (size_t i = 0; i < city_count; i++) {
+    names[i] = "City" + to_string(generator() % 100000) + "_" + to_string(i);
+    builder.addCity(names[i], static_cast<int>(generator() % 2000));
+  }
+  auto addRoad = [&](size_t first, size_t second) {
+    char timestamp[8];
+    snprintf(timestamp, sizeof(timestamp), "%04u-%02u",
+             1985 + static_cast<unsigned>(generator() % 40),
+             1 + static_cast<unsigned>(generator() % 12));
+    builder.addRoad(names[first], names[second],
+                    static_cast<int>(1 + generator() % 600) * 10, timestamp);
+  };
+  for (size_t i = 1; i < city_count; i++)
+    addRoad(i, generator() % i);
+  for (size_t i = city_count - 1; i < road_count; i++)
+    addRoad(generator() % city_count, generator() % city_count);
+  builder.build(graph);
+}
+
+// Builds the MST from city 0 in 'mode' and reports time and heap size.
+static void runBenchmark(const string &name, const RoadGraph &graph,
+                         PrimMode mode) {
+  // A stream without a buffer drops every line, so output is not measured.
+  ostream null_out(nullptr);
+  MST mst(graph, null_out);
+  mst.setPrimMode(mode);
+
+  BenchClock::time_point start = BenchClock::now();
+  mst.setStartingNode(graph.cityName(0));
+  mst.initializeMST();
+  const double elapsed =
+      chrono::duration<double, milli>(BenchClock::now() - start).count();
+
+  cout << name << ((mode == PrimMode::kEager) ? " eager" : " lazy")
+       << ": cities=" << graph.cityCount() << " roads=" << graph.bridgeCount()
+       << " time=" << elapsed << " ms peak_heap=" << mst.peakHeapSize()
+       << " total=" << mst.totalLength() << "\n";
+}
+
+int main(int argc, char **argv) {
+  const size_t sparse_cities =
+      (argc > 1) ? strtoul(argv[1], nullptr, 10) : 1000000;
+  const size_t dense_cities = (argc > 2) ? strtoul(argv[2], nullptr, 10) : 3000;
+
+  RoadGraph sparse;
+  buildRandomGraph(sparse_cities, sparse_cities * 4, sparse);
+  RoadGraph dense;
+  buildRandomGraph(dense_cities, dense_cities * (dense_cities - 1) / 6, dense);
+
+  for (PrimMode mode : {PrimMode::kLazy, PrimMode::kEager}) {
+    runBenchmark("sparse", sparse, mode);
+    runBenchmark("dense", dense, mode);
+  }
+  return 0;
+}
@@ -0,0 +1,109 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-06-29
+ *
+ * Description: Throughput of a batch of what-if scenarios on a random
+ * connected network (5 roads per city by default), evaluated by a thread
+ * pool of 1 .. N threads. Each scenario closes and adds a few roads and
+ * starts from its own city. Checks that every thread count reports the same
+ * totals.
+ * Usage: ./PrimScenarioBatchBench [road_count] [scenario_count] [max_threads]
+ */
+#include "../../src/design_assignment_02/road_scenarios.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+using namespace std;
+
+typedef chrono::steady_clock BenchClock;
+
+// Returns milliseconds since 'start'.
+static double millisSince(const BenchClock::time_point &start) {
+  return chrono::duration<double, milli>(BenchClock::now() - start).count();
+}
+
+// Builds a random connected network of 'city_count' cities and 'road_count'
+// roads (at least city_count - 1).
+static void buildRandomGraph(size_t city_count, size_t road_count,
+                             RoadGraph &graph) {
+  mt19937 generator(20250629);
+  RoadGraphBuilder builder;
+  vector<string> names(city_count);
+  for (size_t i = 0; i < city_count; i++) {
+    names[i] = "City" + to_string(generator() % 100000) + "_" + to_string(i);
+    builder.addCity(names[i], static_cast<int>(generator() % 2000));
+  }
+  auto addRoad = [&](size_t first, size_t second) {
+    char timestamp[8];
+    snprintf(timestamp, sizeof(timestamp), "%04u-%02u",
+             1985 + static_cast<unsigned>(generator() % 40),
+             1 + static_cast<unsigned>(generator() % 12));
+    builder.addRoad(names[first], names[second],
+                    static_cast<int>(1 + generator() % 600) * 10, timestamp);
+  };
+  for (size_t i = 1; i < city_count; i++)
+    addRoad(i, generator() % i);
+  for (size_t i = city_count - 1; i < road_count; i++)
+    addRoad(generator() % city_count, generator() % city_count);
+  builder.build(graph);
+}
+
+int main(int argc, char **argv) {
+  const size_t road_count =
+      (argc > 1) ? strtoul(argv[1], nullptr, 10) : 200000;
+  const size_t scenario_count =
+      (argc > 2) ? strtoul(argv[2], nullptr, 10) : 32;
+  const int max_threads = (argc > 3) ? atoi(argv[3]) : 8;
+
+  BenchClock::time_point start = BenchClock::now();
+  RoadGraph graph;
+  buildRandomGraph(road_count / 5 + 1, road_count, graph);
+  cout << "graph: cities=" << graph.cityCount()
+       << " roads=" << graph.bridgeCount() << " build=" << millisSince(start)
+       << " ms\n";
+
+  mt19937 generator(29);
+  vector<RoadScenario> scenarios(scenario_count);
+  for (RoadScenario &scenario : scenarios) {
+    scenario.starting_city = graph.cityName(generator() % graph.cityCount());
+    for (int i = 0; i < 100; i++)
+      scenario.closed_bridges.push_back(generator() % graph.bridgeCount());
+    for (int i = 0; i < 100; i++) {
+      scenario.added_roads.push_back(ScenarioRoad{
+          graph.cityName(generator() % graph.cityCount()),
+          graph.cityName(generator() % graph.cityCount()),
+          static_cast<int>(1 + generator() % 600) * 10, "2025-06"});
+    }
+  }
+
+  vector<long long> expected_totals;
+  bool same_totals = true;
+  for (int threads = 1; threads <= max_threads; threads *= 2) {
+    ScenarioBatch batch(graph);
+    batch.setThreadCount(threads);
+    batch.setPrimMode(PrimMode::kEager);
+    start = BenchClock::now();
+    vector<ScenarioResult> results = batch.run(scenarios);
+    const double elapsed = millisSince(start);
+    cout << "threads=" << threads << ": " << elapsed << " ms ("
+         << scenario_count * 1000.0 / elapsed << " scenarios/s)\n";
+
+    vector<long long> totals;
+    for (const ScenarioResult &result : results)
+      totals.push_back(result.total_length);
+    if (expected_totals.empty())
+      expected_totals = totals;
+    same_totals = same_totals && (totals == expected_totals);
+  }
+  cout << "same totals: " << (same_totals ? "yes" : "NO") << "\n";
+  return same_totals ? 0 : 1;
+}
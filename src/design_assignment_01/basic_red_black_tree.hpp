@@ -0,0 +1,667 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-07-03
+ *
+ * Description: Header-only Red-Black Tree engine shared by the registration
+ * index and any other ordered index (timestamp, sid, ...). The key order and
+ * the node payload are compile-time policies, so each instantiation gets its
+ * own fully inlined comparator. Insertion runs bottom-up (descend, then fix
+ * double reds on the way back up) or top-down (split 4-nodes while
+ * descending, so a single pass suffices); see InsertMode.
+ */
+#ifndef INHA_ALGORITHM_003_BASIC_RED_BLACK_TREE_HPP
+#define INHA_ALGORITHM_003_BASIC_RED_BLACK_TREE_HPP
+
+#include "node_arena.hpp"
+#include "prefetch.hpp"
+#include <cstddef>
+#include <string>
+#include <utility>
+using namespace std;
+
+// Comparator constants for key ordering (three-way comparison result).
+static constexpr int kCompareLess = -1;
+static constexpr int kCompareEqual = 0;
+static constexpr int kCompareGreater = 1;
+
+// Comparator policy: orders plain integer keys (timestamp, sid, ...).
+struct IntKeyComparator {
+  static int compare(const int &a, const int &b) { return (a > b) - (a < b); }
+};
+
+// Comparator policy: orders composite (sid, subject) keys.
+struct NodeKeyComparator {
+  static int compare(const pair<int, string> &a, const pair<int, string> &b) {
+    if (a.first != b.first) {
+      return (a.first < b.first) ? kCompareLess : kCompareGreater;
+    }
+    const int result = a.second.compare(b.second);
+    return (result > 0) - (result < 0);
+  }
+};
+
+// Payload policy: used by index-only trees that carry nothing but the key.
+struct EmptyPayload {};
+
+// Insertion strategy of a BasicRedBlackTree. Both keep the red-black
+// invariants but may shape the tree differently, so node depths and colors
+// are only comparable between trees using the same mode.
+enum class InsertMode : char {
+  // Descend to the leaf, then recolor/restructure back up the parent chain.
+  kBottomUp,
+  // Split every black node with two red children on the way down and fix the
+  // resulting double red at once; nothing is revisited after the leaf.
+  kTopDown
+};
+
+template <typename Key, typename Value, typename Compare>
+class BasicRedBlackTree;
+
+template <typename Key, typename Value> class BasicNode {
+public:
+  // Constructor: Initializes a red, unlinked node holding key and payload.
+  BasicNode(const Key &key, const Value &value)
+      : key(key), value(value), parent_node(nullptr), left_child(nullptr),
+        right_child(nullptr), color('R') {}
+
+  const Key &getKey() const { return key; }
+  Value &getValue() { return value; }
+  const Value &getValue() const { return value; }
+  char getColor() const { return color; }
+  BasicNode *getParent() const { return parent_node; }
+  BasicNode *getLeftChild() const { return left_child; }
+  BasicNode *getRightChild() const { return right_child; }
+
+private:
+  // Key used for tree ordering.
+  Key key;
+
+  // Payload carried by the node (see payload policies).
+  Value value;
+
+  // Pointer to the parent node in the tree.
+  BasicNode *parent_node;
+
+  // Pointer to the left child in the tree.
+  BasicNode *left_child;
+
+  // Pointer to the right child in the tree.
+  BasicNode *right_child;
+
+  // Node color: 'R' for red, 'B' for black (used in balancing).
+  char color;
+
+  // Grant the tree engine access to private members.
+  template <typename K, typename V, typename C> friend class BasicRedBlackTree;
+};
+
+template <typename Key, typename Value, typename Compare>
+class BasicRedBlackTree {
+public:
+  typedef BasicNode<Key, Value> Node;
+
+  // Result of a descent: the found node (or the would-be parent) and the
+  // direction 'L'/'R' to attach, 'A' if the key already exists, 'E' if empty.
+  typedef pair<Node *, char> SearchResult;
+
+  // Result of an insertion: the node holding the key and whether it already
+  // existed (kIsDuplicateNode) or was newly inserted (kIsNewlyInserted).
+  typedef pair<Node *, bool> InsertResult;
+
+  // Constant: Indicates that the node already exists in the tree.
+  static constexpr bool kIsDuplicateNode = true;
+
+  // Constant: Indicates that the node is newly inserted.
+  static constexpr bool kIsNewlyInserted = false;
+
+  // Constructor: Initializes an empty Red-Black Tree. Nodes are carved from
+  // 'arena' when given (the arena must outlive the tree), else from new.
+  explicit BasicRedBlackTree(NodeArena *arena = nullptr)
+      : tree_root(nullptr), tree_size(0), node_arena(arena),
+        insert_mode(InsertMode::kBottomUp) {}
+  ~BasicRedBlackTree() { deleteSubtree(tree_root); }
+
+  BasicRedBlackTree(const BasicRedBlackTree &) = delete;
+  BasicRedBlackTree &operator=(const BasicRedBlackTree &) = delete;
+
+  // Selects the strategy used by insert() from now on.
+  void setInsertMode(InsertMode mode) { insert_mode = mode; }
+  InsertMode getInsertMode() const { return insert_mode; }
+
+  // Inserts 'key' with 'value' unless it already exists. The payload of an
+  // existing node is left untouched so the caller can decide how to update it.
+  InsertResult insert(const Key &key, const Value &value) {
+    if (insert_mode == InsertMode::kTopDown) {
+      return insertTopDown(key, value);
+    }
+
+    // If the tree is empty, the new node becomes the black root.
+    if (isEmpty()) {
+      tree_root = createNode(key, value);
+      tree_root->color = 'B';
+      tree_size++;
+      return InsertResult(tree_root, kIsNewlyInserted);
+    }
+
+    // Search for a parent or yourself.
+    SearchResult searched_result = searchParentOrSelf(key);
+    Node *parent_or_self = searched_result.first;
+    char parent_direction = searched_result.second;
+
+    // If that key already exists in the tree, nothing is allocated.
+    if (parent_direction == 'A') {
+      return InsertResult(parent_or_self, kIsDuplicateNode);
+    }
+
+    // Update the parent-child relationship.
+    Node *child = createNode(key, value);
+    child->parent_node = parent_or_self;
+    if (parent_direction == 'L')
+      parent_or_self->left_child = child;
+    else
+      parent_or_self->right_child = child;
+    tree_size++;
+
+    // Check the balance of the nodes.
+    adjustRebalance(child);
+    return InsertResult(child, kIsNewlyInserted);
+  }
+
+  // Single-pass insertion: every black node with two red children met on the
+  // way down is split (recolored), and a double red this creates is removed
+  // right there by one restructure, whose uncle is black because the level
+  // above was split already. A duplicate key may still split nodes on its
+  // path, but nothing is allocated.
+  InsertResult insertTopDown(const Key &key, const Value &value) {
+    if (isEmpty()) {
+      tree_root = createNode(key, value);
+      tree_root->color = 'B';
+      tree_size++;
+      return InsertResult(tree_root, kIsNewlyInserted);
+    }
+
+    Node *cur_node = tree_root;
+    while (true) {
+      // Split a 4-node: the black node takes the red of its children.
+      if (!isBlack(cur_node->left_child) && !isBlack(cur_node->right_child)) {
+        cur_node->color = 'R';
+        cur_node->left_child->color = 'B';
+        cur_node->right_child->color = 'B';
+        splitDoubleRed(cur_node);
+      }
+
+      const int result = Compare::compare(cur_node->key, key);
+      if (result == kCompareEqual) {
+        return InsertResult(cur_node, kIsDuplicateNode);
+      }
+      Node *next_node =
+          (result > 0) ? cur_node->left_child : cur_node->right_child;
+      if (next_node == nullptr) {
+        Node *child = createNode(key, value);
+        child->parent_node = cur_node;
+        if (result > 0)
+          cur_node->left_child = child;
+        else
+          cur_node->right_child = child;
+        tree_size++;
+        splitDoubleRed(child);
+        return InsertResult(child, kIsNewlyInserted);
+      }
+      cur_node = next_node;
+    }
+  }
+
+  // Unlinks 'node' from the tree, rebalances and frees it. Other nodes keep
+  // their addresses, so pointers held by secondary indexes stay valid.
+  void erase(Node *node) {
+    Node *removed_node = node;
+    char removed_color = removed_node->color;
+    Node *fix_node;
+    Node *fix_parent;
+
+    if (node->left_child == nullptr) {
+      fix_node = node->right_child;
+      fix_parent = node->parent_node;
+      transplant(node, node->right_child);
+    } else if (node->right_child == nullptr) {
+      fix_node = node->left_child;
+      fix_parent = node->parent_node;
+      transplant(node, node->left_child);
+    } else {
+      // Two children: the in-order successor takes the node's place.
+      removed_node = leftmost(node->right_child);
+      removed_color = removed_node->color;
+      fix_node = removed_node->right_child;
+      if (removed_node->parent_node == node) {
+        fix_parent = removed_node;
+      } else {
+        fix_parent = removed_node->parent_node;
+        transplant(removed_node, removed_node->right_child);
+        removed_node->right_child = node->right_child;
+        removed_node->right_child->parent_node = removed_node;
+      }
+      transplant(node, removed_node);
+      removed_node->left_child = node->left_child;
+      removed_node->left_child->parent_node = removed_node;
+      removed_node->color = node->color;
+    }
+    tree_size--;
+    destroyNode(node);
+
+    // Removing a black node leaves one path short of a black node.
+    if (removed_color == 'B') {
+      adjustEraseRebalance(fix_node, fix_parent);
+    }
+  }
+
+  // Returns the first node whose key is not less than 'key', or nullptr.
+  Node *lowerBound(const Key &key) const {
+    Node *cur_node = tree_root;
+    Node *candidate = nullptr;
+    while (cur_node != nullptr) {
+      if (Compare::compare(cur_node->key, key) >= 0) {
+        candidate = cur_node;
+        cur_node = cur_node->left_child;
+      } else {
+        cur_node = cur_node->right_child;
+      }
+    }
+    return candidate;
+  }
+
+  // lowerBound for 'count' keys at once: results[i] = lowerBound(keys[i]).
+  // Up to kBatchLanes descents advance in lockstep and each one prefetches
+  // its next node before the other lanes take their step, so the cache
+  // misses of independent lookups overlap instead of queueing.
+  void lowerBoundBatch(const Key *keys, size_t count, Node **results) const {
+    struct Lane {
+      size_t index;
+      Node *cur_node;
+      Node *candidate;
+    };
+    Lane lanes[kBatchLanes];
+    size_t active_count = 0;
+    size_t next_index = 0;
+    while (active_count < kBatchLanes && next_index < count) {
+      lanes[active_count++] = Lane{next_index++, tree_root, nullptr};
+    }
+
+    while (active_count > 0) {
+      for (size_t i = 0; i < active_count; i++) {
+        Lane &lane = lanes[i];
+        if (lane.cur_node == nullptr) {
+          // This descent is done: hand the lane to the next key.
+          results[lane.index] = lane.candidate;
+          if (next_index < count) {
+            lane = Lane{next_index++, tree_root, nullptr};
+          } else {
+            lane = lanes[--active_count];
+            i--;
+          }
+          continue;
+        }
+        if (Compare::compare(lane.cur_node->key, keys[lane.index]) >= 0) {
+          lane.candidate = lane.cur_node;
+          lane.cur_node = lane.cur_node->left_child;
+        } else {
+          lane.cur_node = lane.cur_node->right_child;
+        }
+        INHA_PREFETCH(lane.cur_node);
+      }
+    }
+  }
+
+  // find for 'count' keys at once (see lowerBoundBatch).
+  void findBatch(const Key *keys, size_t count, Node **results) const {
+    lowerBoundBatch(keys, count, results);
+    for (size_t i = 0; i < count; i++) {
+      if (results[i] != nullptr &&
+          Compare::compare(results[i]->key, keys[i]) != kCompareEqual) {
+        results[i] = nullptr;
+      }
+    }
+  }
+
+  // Number of lookups lowerBoundBatch keeps in flight.
+  static constexpr size_t kBatchLanes = 8;
+
+  // Returns the node with the smallest key, or nullptr when empty.
+  Node *first() const {
+    return (tree_root == nullptr) ? nullptr : leftmost(tree_root);
+  }
+
+  // Returns the in-order successor of 'node', or nullptr for the last node.
+  static Node *successor(const Node *node) {
+    if (node->right_child != nullptr) {
+      return leftmost(node->right_child);
+    }
+    Node *par_node = node->parent_node;
+    while (par_node != nullptr && par_node->right_child == node) {
+      node = par_node;
+      par_node = par_node->parent_node;
+    }
+    return par_node;
+  }
+
+  // Returns the node holding 'key', or nullptr if it does not exist.
+  Node *find(const Key &key) const {
+    SearchResult searched_result = searchParentOrSelf(key);
+    return (searched_result.second == 'A') ? searched_result.first : nullptr;
+  }
+
+  // Search for a parent or yourself (iterative descent from the root).
+  SearchResult searchParentOrSelf(const Key &key) const {
+    Node *cur_node = tree_root;
+    if (cur_node == nullptr) {
+      return SearchResult(nullptr, 'E');
+    }
+
+    while (true) {
+      const int result = Compare::compare(cur_node->key, key);
+      if (result == kCompareEqual) {
+        // If it's already exist, return self node.
+        return SearchResult(cur_node, 'A');
+      }
+      Node *next_node =
+          (result > 0) ? cur_node->left_child : cur_node->right_child;
+      if (next_node == nullptr) {
+        // Founded cur_node's parent!
+        return SearchResult(cur_node, (result > 0) ? 'L' : 'R');
+      }
+      cur_node = next_node;
+    }
+  }
+
+  // Returns the depth (level) of a node from the root.
+  static int getNodeDepth(const Node *cur_node) {
+    int depth = 0;
+    while (cur_node->parent_node != nullptr) {
+      cur_node = cur_node->parent_node;
+      depth++;
+    }
+    return depth;
+  }
+
+  // Checks if the tree is empty.
+  bool isEmpty() const { return (tree_size == 0); }
+
+  // Total number of nodes currently in the tree.
+  int size() const { return tree_size; }
+
+  // Root node of the tree (nullptr when empty).
+  Node *root() const { return tree_root; }
+
+private:
+  // Allocates a node from the arena (if any) or the heap.
+  Node *createNode(const Key &key, const Value &value) {
+    if (node_arena == nullptr) {
+      return new Node(key, value);
+    }
+    void *memory = node_arena->allocate(sizeof(Node), alignof(Node));
+    return new (memory) Node(key, value);
+  }
+
+  // Frees a single node allocated by createNode.
+  void destroyNode(Node *node) {
+    if (node_arena == nullptr) {
+      delete node;
+    } else {
+      node->~Node();
+      node_arena->deallocate(node, sizeof(Node), alignof(Node));
+    }
+  }
+
+  // Returns the leftmost (smallest) node of the subtree rooted at 'node'.
+  static Node *leftmost(Node *node) {
+    while (node->left_child != nullptr)
+      node = node->left_child;
+    return node;
+  }
+
+  // Puts 'new_child' (possibly null) in the tree position of 'old_node'.
+  void transplant(Node *old_node, Node *new_child) {
+    Node *par_node = old_node->parent_node;
+    if (par_node == nullptr)
+      tree_root = new_child;
+    else if (par_node->left_child == old_node)
+      par_node->left_child = new_child;
+    else
+      par_node->right_child = new_child;
+    if (new_child != nullptr)
+      new_child->parent_node = par_node;
+  }
+
+  // Restores the black height after erasing a black node. 'cur_node' (maybe
+  // null) carries the extra black; 'par_node' is its parent.
+  void adjustEraseRebalance(Node *cur_node, Node *par_node) {
+    while (cur_node != tree_root && isBlack(cur_node)) {
+      const bool is_left = (par_node->left_child == cur_node);
+      Node *sibling_node = is_left ? par_node->right_child
+                                   : par_node->left_child;
+
+      // Red sibling: rotate it above the parent to get a black sibling.
+      if (sibling_node->color == 'R') {
+        sibling_node->color = 'B';
+        par_node->color = 'R';
+        if (is_left)
+          rotateLeft(par_node);
+        else
+          rotateRight(par_node);
+        sibling_node = is_left ? par_node->right_child : par_node->left_child;
+      }
+
+      Node *near_child =
+          is_left ? sibling_node->left_child : sibling_node->right_child;
+      Node *far_child =
+          is_left ? sibling_node->right_child : sibling_node->left_child;
+
+      // Black sibling with black children: recolor and move the extra black up.
+      if (isBlack(near_child) && isBlack(far_child)) {
+        sibling_node->color = 'R';
+        cur_node = par_node;
+        par_node = cur_node->parent_node;
+        continue;
+      }
+
+      // Only the near child is red: rotate it into the far position first.
+      if (isBlack(far_child)) {
+        near_child->color = 'B';
+        sibling_node->color = 'R';
+        if (is_left)
+          rotateRight(sibling_node);
+        else
+          rotateLeft(sibling_node);
+        sibling_node = is_left ? par_node->right_child : par_node->left_child;
+        far_child =
+            is_left ? sibling_node->right_child : sibling_node->left_child;
+      }
+
+      // Far child is red: one rotation at the parent absorbs the extra black.
+      sibling_node->color = par_node->color;
+      par_node->color = 'B';
+      far_child->color = 'B';
+      if (is_left)
+        rotateLeft(par_node);
+      else
+        rotateRight(par_node);
+      cur_node = tree_root;
+    }
+    if (cur_node != nullptr) {
+      cur_node->color = 'B';
+    }
+  }
+
+  // Recursively deletes all nodes in the subtree rooted at 'node' using
+  // post-order traversal. Arena nodes go on the arena's free list until the
+  // arena is reset.
+  void deleteSubtree(Node *node) {
+    if (!node)
+      return;
+
+    deleteSubtree(node->left_child);
+    deleteSubtree(node->right_child);
+    destroyNode(node);
+  }
+
+  // Checks if a node is black or null (used in balancing).
+  static bool isBlack(const Node *node) {
+    return (node == nullptr || node->color == 'B');
+  }
+
+  // Checks whether the current node and its parent are both red.
+  static bool isDoubleRed(const Node *cur_node) {
+    if (cur_node->color == 'B') {
+      return false;
+    }
+    if (cur_node->parent_node == nullptr) {
+      return false;
+    }
+    return (cur_node->parent_node->color == 'R');
+  }
+
+  // Returns the sibling of the current node.
+  static Node *getSibling(const Node *cur_node) {
+    Node *par_node = cur_node->parent_node;
+    if (par_node->left_child == cur_node) {
+      return par_node->right_child;
+    }
+    return par_node->left_child;
+  }
+
+  // Flips the color of a node ('R' ↔ 'B').
+  static void flipColor(Node *node) {
+    node->color = (node->color == 'R') ? 'B' : 'R';
+  }
+
+  // Top-down fix for the red 'cur_node': the root turns black again, and a
+  // red parent (whose sibling is black) is restructured away.
+  void splitDoubleRed(Node *cur_node) {
+    if (cur_node == tree_root) {
+      cur_node->color = 'B';
+      return;
+    }
+    if (isDoubleRed(cur_node)) {
+      adjustRestructure(cur_node);
+    }
+  }
+
+  // Repeat until double red does not occur.
+  void adjustRebalance(Node *cur_node) {
+    while (isDoubleRed(cur_node)) {
+      if (isBlack(getSibling(cur_node->parent_node))) {
+        adjustRestructure(cur_node);
+        break;
+      }
+      cur_node = adjustRecolor(cur_node);
+    }
+  }
+
+  // Performs restructuring when double red occurs.
+  void adjustRestructure(Node *cur_node) {
+    Node *par_node = cur_node->parent_node;
+    Node *grand_par_node = par_node->parent_node;
+    const bool is_left_parent = (grand_par_node->left_child == par_node);
+    const bool is_left_child = (par_node->left_child == cur_node);
+
+    // LL / RR: the parent becomes the middle of the restructured trinode.
+    // LR / RL: the current node becomes the middle.
+    Node *middle_node = (is_left_parent == is_left_child) ? par_node : cur_node;
+    middle_node->color = 'B';
+    grand_par_node->color = 'R';
+    (middle_node == par_node ? cur_node : par_node)->color = 'R';
+
+    if (is_left_parent) {
+      if (!is_left_child)
+        rotateLeft(par_node);
+      rotateRight(grand_par_node);
+    } else {
+      if (is_left_child)
+        rotateRight(par_node);
+      rotateLeft(grand_par_node);
+    }
+  }
+
+  // Recolors grandparent-parent-sibling nodes and returns new current node.
+  Node *adjustRecolor(Node *cur_node) {
+    Node *par_node = cur_node->parent_node;
+    Node *grand_par_node = par_node->parent_node;
+
+    flipColor(grand_par_node);
+    flipColor(par_node);
+    flipColor(getSibling(par_node));
+
+    if (grand_par_node == tree_root && grand_par_node->color == 'R') {
+      grand_par_node->color = 'B';
+    }
+    return grand_par_node;
+  }
+
+  // Replaces 'old_root' by 'new_root' in the child slot of old_root's parent.
+  void replaceInParent(Node *old_root, Node *new_root) {
+    Node *par_node = old_root->parent_node;
+    new_root->parent_node = par_node;
+    old_root->parent_node = new_root;
+
+    // If new_root is the root of the tree,
+    if (par_node == nullptr) {
+      tree_root = new_root;
+      return;
+    }
+    if (par_node->left_child == old_root)
+      par_node->left_child = new_root;
+    else
+      par_node->right_child = new_root;
+  }
+
+  // Performs right rotation at the given node.
+  void rotateRight(Node *old_root) {
+    Node *new_root = old_root->left_child;
+    Node *middle_subtree = new_root->right_child;
+
+    old_root->left_child = middle_subtree;
+    if (middle_subtree) {
+      middle_subtree->parent_node = old_root;
+    }
+    replaceInParent(old_root, new_root);
+    new_root->right_child = old_root;
+  }
+
+  // Performs left rotation at the given node.
+  void rotateLeft(Node *old_root) {
+    Node *new_root = old_root->right_child;
+    Node *middle_subtree = new_root->left_child;
+
+    old_root->right_child = middle_subtree;
+    if (middle_subtree) {
+      middle_subtree->parent_node = old_root;
+    }
+    replaceInParent(old_root, new_root);
+    new_root->left_child = old_root;
+  }
+
+  // Root node of the Red-Black Tree.
+  Node *tree_root;
+
+  // Total number of nodes currently in the tree.
+  int tree_size;
+
+  // Arena supplying node memory, or nullptr to use new/delete.
+  NodeArena *node_arena;
+
+  // Strategy used by insert().
+  InsertMode insert_mode;
+};
+
+template <typename Key, typename Value, typename Compare>
+constexpr bool BasicRedBlackTree<Key, Value, Compare>::kIsDuplicateNode;
+template <typename Key, typename Value, typename Compare>
+constexpr bool BasicRedBlackTree<Key, Value, Compare>::kIsNewlyInserted;
+template <typename Key, typename Value, typename Compare>
+constexpr size_t BasicRedBlackTree<Key, Value, Compare>::kBatchLanes;
+
+#endif // INHA_ALGORITHM_003_BASIC_RED_BLACK_TREE_HPP
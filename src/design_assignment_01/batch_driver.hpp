@@ -0,0 +1,110 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-07-03
+ *
+ * Description: Batch driver that runs many independent query files in one
+ * process. Each file gets its own RedBlackTree on a work-stealing pool, and
+ * every worker reuses one node arena for all the files it processes.
+ */
+#ifndef INHA_ALGORITHM_003_BATCH_DRIVER_HPP
+#define INHA_ALGORITHM_003_BATCH_DRIVER_HPP
+
+#include "node_arena.hpp"
+#include "query_pipeline.hpp"
+#include "red_black_tree.hpp"
+#include "work_stealing_pool.hpp"
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+using namespace std;
+
+struct BatchOptions {
+  // Number of worker threads (0 picks the hardware concurrency).
+  int thread_count = 0;
+
+  // Directory for the outputs; empty writes each output next to its input.
+  string output_dir;
+};
+
+// Returns the output path of 'input_path': "x.in" -> "x.out", else "x.out"
+// appended, placed in 'output_dir' when it is not empty.
+inline string batchOutputPath(const string &input_path,
+                              const string &output_dir) {
+  string name = input_path;
+  if (!output_dir.empty()) {
+    const size_t slash = name.find_last_of('/');
+    if (slash != string::npos)
+      name = name.substr(slash + 1);
+    name = output_dir + "/" + name;
+  }
+  const string kInputSuffix = ".in";
+  if (name.size() > kInputSuffix.size() &&
+      name.compare(name.size() - kInputSuffix.size(), kInputSuffix.size(),
+                   kInputSuffix) == 0) {
+    name.resize(name.size() - kInputSuffix.size());
+  }
+  return name + ".out";
+}
+
+// Runs every input file through its own RedBlackTree. Returns the number of
+// files that could not be opened, or whose output could not be fully
+// written and closed.
+inline int runBatch(const vector<string> &input_paths,
+                    const BatchOptions &options) {
+  int thread_count = options.thread_count;
+  if (thread_count <= 0) {
+    thread_count = static_cast<int>(thread::hardware_concurrency());
+  }
+
+  WorkStealingPool pool(thread_count);
+
+  // One arena per worker, reset between files so blocks are reused.
+  vector<unique_ptr<NodeArena>> arenas;
+  for (int i = 0; i < pool.size(); i++)
+    arenas.emplace_back(new NodeArena());
+
+  atomic<int> failed_count(0);
+  for (const string &input_path : input_paths) {
+    pool.submit([&, input_path](int worker_index) {
+      const string output_path =
+          batchOutputPath(input_path, options.output_dir);
+      FILE *input = fopen(input_path.c_str(), "rb");
+      FILE *output = (input != nullptr) ? fopen(output_path.c_str(), "wb")
+                                        : nullptr;
+      if (input == nullptr || output == nullptr) {
+        fprintf(stderr, "Cannot process %s\n", input_path.c_str());
+        failed_count++;
+      } else {
+        NodeArena &arena = *arenas[worker_index];
+        {
+          RedBlackTree tree(&arena);
+          runSequential(tree, input, output);
+        }
+        arena.reset();
+      }
+      if (input != nullptr)
+        fclose(input);
+      if (output != nullptr) {
+        // A short write (e.g. a full disk) sets the error flag, and fclose
+        // reports a failure of the final flush.
+        const bool write_failed = (ferror(output) != 0);
+        if ((fclose(output) != 0) || write_failed) {
+          fprintf(stderr, "Cannot write %s\n", output_path.c_str());
+          failed_count++;
+        }
+      }
+    });
+  }
+  pool.wait();
+
+  return failed_count;
+}
+
+#endif // INHA_ALGORITHM_003_BATCH_DRIVER_HPP
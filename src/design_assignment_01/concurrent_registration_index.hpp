@@ -0,0 +1,149 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-07-03
+ *
+ * Description: Multi-writer registration backend on ConcurrentSkiplist, keyed
+ * on (sid, subject) like StudentTree. Inserts follow inquireInsert: a new key
+ * stores the whole record, an existing key only moves its timestamp. There is
+ * no balanced tree, so L answers carry subjects and timestamps, not colors.
+ * Replaced timestamps form a shared list, so the copy a duplicate insert
+ * makes costs the same however long the history is. The backend is a
+ * library only; the drivers keep answering from RedBlackTree.
+ */
+#ifndef INHA_ALGORITHM_003_CONCURRENT_REGISTRATION_INDEX_HPP
+#define INHA_ALGORITHM_003_CONCURRENT_REGISTRATION_INDEX_HPP
+
+#include "concurrent_skiplist.hpp"
+#include "red_black_tree.hpp"
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+using namespace std;
+
+// One replaced timestamp, linked to the one it replaced. Nodes are never
+// changed after they are shared, so snapshots can hold the same list.
+struct ReplacedTimestamp {
+  ReplacedTimestamp(int timestamp, shared_ptr<ReplacedTimestamp> earlier)
+      : timestamp(timestamp), earlier(move(earlier)) {}
+
+  // Releases the list one node at a time, so a long history does not
+  // recurse through the destructors.
+  ~ReplacedTimestamp() {
+    shared_ptr<ReplacedTimestamp> next = move(earlier);
+    while (next != nullptr && next.use_count() == 1)
+      next = move(next->earlier);
+  }
+
+  int timestamp;
+  shared_ptr<ReplacedTimestamp> earlier;
+};
+
+// Payload of each skiplist node. Like StudentRecord, except that the
+// history is shared between snapshots instead of copied.
+struct ConcurrentStudentRecord {
+  // Student name.
+  string sname;
+
+  // Semester number.
+  int semester;
+
+  // Phone number.
+  string phone;
+
+  // Current timestamp.
+  int timestamp;
+
+  // Latest replaced timestamp, or nullptr if there is none.
+  shared_ptr<ReplacedTimestamp> history;
+};
+
+typedef ConcurrentSkiplist<NodeKey, ConcurrentStudentRecord, NodeKeyComparator>
+    StudentSkiplist;
+
+// One "L" item: (subject, current timestamp).
+typedef pair<string, int> SubjectTimestampPair;
+
+class ConcurrentRegistrationIndex {
+public:
+  // 'thread_count' threads may call in, each with its own thread index.
+  explicit ConcurrentRegistrationIndex(int thread_count)
+      : student_list(thread_count) {}
+
+  // Query Type: “I sid subject sname semester phone timestamp”, from thread
+  // 'thread_id'. Returns StudentSkiplist::kIsDuplicateNode when the key
+  // already existed and only its timestamp was updated.
+  bool inquireInsert(const int &sid, const string &subject,
+                     const string &sname, const int &semester,
+                     const string &phone, const int &timestamp,
+                     int thread_id) {
+    StudentSkiplist::InsertResult inserted_result = student_list.insert(
+        NodeKey(sid, subject),
+        ConcurrentStudentRecord{sname, semester, phone, timestamp, nullptr},
+        thread_id);
+    if (inserted_result.second == StudentSkiplist::kIsDuplicateNode) {
+      student_list.update(
+          inserted_result.first,
+          [&timestamp](ConcurrentStudentRecord &record) {
+            record.history = make_shared<ReplacedTimestamp>(
+                record.timestamp, move(record.history));
+            record.timestamp = timestamp;
+          },
+          thread_id);
+    }
+    return inserted_result.second;
+  }
+
+  // Query Type: “L sid”: the student's subjects in dictionary order with
+  // their current timestamps. Returns false when the student has none.
+  bool inquireAllSubjects(const int &sid,
+                          vector<SubjectTimestampPair> &subjects,
+                          int thread_id) {
+    subjects.clear();
+    student_list.scanFrom(
+        NodeKey(sid, string()),
+        [&](const NodeKey &key, const ConcurrentStudentRecord &record) {
+          if (key.first != sid)
+            return false;
+          subjects.push_back(
+              SubjectTimestampPair(key.second, record.timestamp));
+          return true;
+        },
+        thread_id);
+    return !subjects.empty();
+  }
+
+  // Timestamps the registration (sid, subject) held before its current one,
+  // oldest first. Returns false when there is no such registration.
+  bool inquireTimestampHistory(const int &sid, const string &subject,
+                               vector<int> &history, int thread_id) {
+    history.clear();
+    bool found = false;
+    student_list.scanFrom(
+        NodeKey(sid, subject),
+        [&](const NodeKey &key, const ConcurrentStudentRecord &record) {
+          found = (key.first == sid && key.second == subject);
+          for (const ReplacedTimestamp *replaced = record.history.get();
+               found && replaced != nullptr; replaced = replaced->earlier.get())
+            history.push_back(replaced->timestamp);
+          return false;
+        },
+        thread_id);
+    reverse(history.begin(), history.end());
+    return found;
+  }
+
+  // Number of registrations (exact once writers are quiescent).
+  size_t size() const { return student_list.size(); }
+
+private:
+  StudentSkiplist student_list;
+};
+
+#endif // INHA_ALGORITHM_003_CONCURRENT_REGISTRATION_INDEX_HPP
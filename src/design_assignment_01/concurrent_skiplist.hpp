@@ -0,0 +1,247 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-06-15
+ *
+ * Description: Lock-free ordered skiplist for concurrent writers. Nodes are
+ * linked bottom-up with CAS and never unlinked, so a node address stays valid
+ * for the list's lifetime. Values are immutable snapshots replaced by
+ * copy-and-CAS; the replaced snapshot is retired through an EpochReclaimer
+ * because a concurrent reader may still be copying it.
+ */
+#ifndef INHA_ALGORITHM_003_CONCURRENT_SKIPLIST_HPP
+#define INHA_ALGORITHM_003_CONCURRENT_SKIPLIST_HPP
+
+#include "epoch_reclaimer.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+using namespace std;
+
+template <typename Key, typename Value, typename Compare>
+class ConcurrentSkiplist {
+public:
+  class Node {
+  public:
+    // Getter
+    const Key &getKey() const { return key; }
+    int getHeight() const { return height; }
+    Node *getNext(int level) const {
+      return next[level].load(memory_order_acquire);
+    }
+
+  private:
+    friend class ConcurrentSkiplist;
+
+    Node(const Key &key, Value *value, int height, atomic<Node *> *next)
+        : key(key), value(value), height(height), next(next) {}
+
+    Key key;
+    atomic<Value *> value;
+    int height;
+
+    // 'height' forward links, stored right after the node itself.
+    atomic<Node *> *next;
+  };
+
+  // (node, duplicate status); the status is kIsDuplicateNode when the key was
+  // already present and the list is unchanged.
+  typedef pair<Node *, bool> InsertResult;
+
+  // Duplicate status of an insert
+  static constexpr bool kIsDuplicateNode = true;
+  static constexpr bool kIsNewlyInserted = false;
+
+  // Tallest tower; with p = 1/2 this covers far more than 2^20 keys.
+  static constexpr int kMaxHeight = 24;
+
+  // 'thread_count' is the number of distinct thread indexes that will call
+  // in; each call passes its own index in [0, thread_count).
+  explicit ConcurrentSkiplist(int thread_count)
+      : reclaimer(thread_count),
+        random_states(new RandomState[reclaimer.size()]), node_count(0) {
+    head = createNode(Key(), nullptr, kMaxHeight);
+    for (int i = 0; i < reclaimer.size(); i++)
+      random_states[i].state = 0x9E3779B97F4A7C15ull * (i + 1);
+  }
+
+  ~ConcurrentSkiplist() {
+    Node *node = head;
+    while (node != nullptr) {
+      Node *next_node = node->getNext(0);
+      delete node->value.load(memory_order_relaxed);
+      destroyNode(node);
+      node = next_node;
+    }
+  }
+
+  ConcurrentSkiplist(const ConcurrentSkiplist &) = delete;
+  ConcurrentSkiplist &operator=(const ConcurrentSkiplist &) = delete;
+
+  // Inserts (key, value) unless 'key' exists; lock-free.
+  InsertResult insert(const Key &key, const Value &value, int thread_id) {
+    Node *preds[kMaxHeight];
+    Node *succs[kMaxHeight];
+    Node *new_node = nullptr;
+
+    // Publish at level 0; the CAS fails only if a neighbour changed.
+    while (true) {
+      Node *found = findPosition(key, preds, succs);
+      if (found != nullptr) {
+        if (new_node != nullptr) {
+          delete new_node->value.load(memory_order_relaxed);
+          destroyNode(new_node);
+        }
+        return InsertResult(found, kIsDuplicateNode);
+      }
+      if (new_node == nullptr)
+        new_node = createNode(key, new Value(value), randomHeight(thread_id));
+      for (int level = 0; level < new_node->height; level++)
+        new_node->next[level].store(succs[level], memory_order_relaxed);
+      if (preds[0]->next[0].compare_exchange_strong(succs[0], new_node,
+                                                    memory_order_release,
+                                                    memory_order_relaxed))
+        break;
+    }
+    node_count.fetch_add(1, memory_order_relaxed);
+
+    // Upper levels are shortcuts only, so they may be linked afterwards.
+    for (int level = 1; level < new_node->height; level++) {
+      while (!preds[level]->next[level].compare_exchange_strong(
+          succs[level], new_node, memory_order_release,
+          memory_order_relaxed)) {
+        findPosition(key, preds, succs);
+        new_node->next[level].store(succs[level], memory_order_relaxed);
+      }
+    }
+    return InsertResult(new_node, kIsNewlyInserted);
+  }
+
+  // Replaces the node's value with a copy modified by 'update_value'. Racing
+  // updates are applied one after another, none is lost.
+  template <typename Update>
+  void update(Node *node, Update update_value, int thread_id) {
+    EpochGuard guard(reclaimer, thread_id);
+    Value *current = node->value.load(memory_order_acquire);
+    Value *replacement = new Value(*current);
+    update_value(*replacement);
+    while (!node->value.compare_exchange_weak(current, replacement,
+                                              memory_order_acq_rel,
+                                              memory_order_acquire)) {
+      *replacement = *current;
+      update_value(*replacement);
+    }
+    reclaimer.retire(thread_id, current);
+  }
+
+  // Calls visit(key, value) on every node from the first key not less than
+  // 'from', in key order, until it returns false.
+  template <typename Visit>
+  void scanFrom(const Key &from, Visit visit, int thread_id) {
+    EpochGuard guard(reclaimer, thread_id);
+    Node *node = lowerBound(from);
+    while (node != nullptr &&
+           visit(node->key, *node->value.load(memory_order_acquire)))
+      node = node->getNext(0);
+  }
+
+  // Returns the node holding 'key', or nullptr.
+  Node *find(const Key &key) const {
+    Node *node = lowerBound(key);
+    return (node != nullptr && Compare::compare(node->key, key) == 0) ? node
+                                                                      : nullptr;
+  }
+
+  // Number of keys (exact once writers are quiescent).
+  size_t size() const { return node_count.load(memory_order_relaxed); }
+
+private:
+  struct RandomState {
+    uint64_t state;
+    char padding[64 - sizeof(uint64_t)];
+  };
+
+  // Allocates the node and its forward links in one block.
+  static Node *createNode(const Key &key, Value *value, int height) {
+    char *block = static_cast<char *>(
+        ::operator new(sizeof(Node) + height * sizeof(atomic<Node *>)));
+    atomic<Node *> *next =
+        reinterpret_cast<atomic<Node *> *>(block + sizeof(Node));
+    for (int level = 0; level < height; level++)
+      new (next + level) atomic<Node *>(nullptr);
+    return new (block) Node(key, value, height, next);
+  }
+
+  static void destroyNode(Node *node) {
+    node->~Node();
+    ::operator delete(static_cast<void *>(node));
+  }
+
+  // Fills the predecessor and successor of 'key' at every level; returns the
+  // node holding 'key' or nullptr.
+  Node *findPosition(const Key &key, Node **preds, Node **succs) const {
+    Node *pred = head;
+    for (int level = kMaxHeight - 1; level >= 0; level--) {
+      Node *curr = pred->getNext(level);
+      while (curr != nullptr && Compare::compare(curr->key, key) < 0) {
+        pred = curr;
+        curr = pred->getNext(level);
+      }
+      preds[level] = pred;
+      succs[level] = curr;
+    }
+    Node *candidate = succs[0];
+    return (candidate != nullptr && Compare::compare(candidate->key, key) == 0)
+               ? candidate
+               : nullptr;
+  }
+
+  // Returns the first node whose key is not less than 'key', or nullptr.
+  Node *lowerBound(const Key &key) const {
+    Node *pred = head;
+    Node *curr = nullptr;
+    for (int level = kMaxHeight - 1; level >= 0; level--) {
+      curr = pred->getNext(level);
+      while (curr != nullptr && Compare::compare(curr->key, key) < 0) {
+        pred = curr;
+        curr = pred->getNext(level);
+      }
+    }
+    return curr;
+  }
+
+  // Geometric tower height (p = 1/2) from the caller's own generator.
+  int randomHeight(int thread_id) {
+    uint64_t &state = random_states[thread_id].state;
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    uint64_t bits = state;
+    int height = 1;
+    while ((bits & 1) && height < kMaxHeight) {
+      height++;
+      bits >>= 1;
+    }
+    return height;
+  }
+
+  EpochReclaimer reclaimer;
+  unique_ptr<RandomState[]> random_states;
+  Node *head;
+  atomic<size_t> node_count;
+};
+
+template <typename Key, typename Value, typename Compare>
+constexpr bool ConcurrentSkiplist<Key, Value, Compare>::kIsDuplicateNode;
+template <typename Key, typename Value, typename Compare>
+constexpr bool ConcurrentSkiplist<Key, Value, Compare>::kIsNewlyInserted;
+template <typename Key, typename Value, typename Compare>
+constexpr int ConcurrentSkiplist<Key, Value, Compare>::kMaxHeight;
+
+#endif // INHA_ALGORITHM_003_CONCURRENT_SKIPLIST_HPP
@@ -0,0 +1,176 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-06-15
+ *
+ * Description: Epoch-based reclamation for lock-free structures. Readers pin
+ * the global epoch while they hold raw pointers; an object retired in epoch e
+ * is freed once the epoch reaches e + 2, when no pinned reader can still see
+ * it. Each participating thread owns one slot, chosen by its thread index.
+ */
+#ifndef INHA_ALGORITHM_003_EPOCH_RECLAIMER_HPP
+#define INHA_ALGORITHM_003_EPOCH_RECLAIMER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+using namespace std;
+
+class EpochReclaimer {
+public:
+  explicit EpochReclaimer(int thread_count)
+      : global_epoch(kFirstEpoch),
+        slots(new ThreadSlot[thread_count < 1 ? 1 : thread_count]),
+        slot_count(thread_count < 1 ? 1 : thread_count) {}
+
+  // Frees every object still waiting; no thread may be pinned any more.
+  ~EpochReclaimer() {
+    for (int i = 0; i < slot_count; i++) {
+      for (int bucket = 0; bucket < kBucketCount; bucket++)
+        freeBucket(slots[i], bucket);
+    }
+  }
+
+  EpochReclaimer(const EpochReclaimer &) = delete;
+  EpochReclaimer &operator=(const EpochReclaimer &) = delete;
+
+  // Number of thread slots.
+  int size() const { return slot_count; }
+
+  // Pins the current epoch for 'thread_id' (must not be pinned already).
+  void enter(int thread_id) {
+    ThreadSlot &slot = slots[thread_id];
+    uint64_t epoch = global_epoch.load();
+    // Re-read until the pin matches the epoch it was taken in.
+    while (true) {
+      slot.local_epoch.store(epoch);
+      const uint64_t current = global_epoch.load();
+      if (current == epoch)
+        break;
+      epoch = current;
+    }
+  }
+
+  // Unpins 'thread_id'.
+  void exit(int thread_id) {
+    slots[thread_id].local_epoch.store(kInactive, memory_order_release);
+  }
+
+  // Hands 'object' (already unreachable for new readers) to the reclaimer.
+  // Called by 'thread_id' while it is pinned.
+  template <typename T> void retire(int thread_id, T *object) {
+    ThreadSlot &slot = slots[thread_id];
+    const uint64_t epoch = global_epoch.load();
+    const int bucket = static_cast<int>(epoch % kBucketCount);
+    if (slot.bucket_epoch[bucket] != epoch) {
+      // The bucket still holds objects from epoch - 3 or older.
+      freeBucket(slot, bucket);
+      slot.bucket_epoch[bucket] = epoch;
+    }
+    slot.buckets[bucket].push_back(
+        RetiredObject{object, [](void *ptr) { delete static_cast<T *>(ptr); }});
+    slot.retired_count++;
+
+    if (++slot.retires_since_advance >= kAdvanceInterval) {
+      slot.retires_since_advance = 0;
+      tryAdvance();
+      reclaim(slot);
+    }
+  }
+
+  // Moves the global epoch forward if every pinned thread has observed it.
+  bool tryAdvance() {
+    uint64_t epoch = global_epoch.load();
+    for (int i = 0; i < slot_count; i++) {
+      const uint64_t local = slots[i].local_epoch.load();
+      if (local != kInactive && local != epoch)
+        return false;
+    }
+    return global_epoch.compare_exchange_strong(epoch, epoch + 1);
+  }
+
+  // Objects retired by 'thread_id' that have not been freed yet.
+  size_t pendingCount(int thread_id) const {
+    return slots[thread_id].retired_count - slots[thread_id].freed_count;
+  }
+
+  // Frees the objects 'thread_id' retired at least two epochs ago.
+  void reclaim(int thread_id) { reclaim(slots[thread_id]); }
+
+private:
+  static constexpr uint64_t kInactive = ~static_cast<uint64_t>(0);
+  static constexpr uint64_t kFirstEpoch = 1;
+  static constexpr int kBucketCount = 3;
+  static constexpr int kAdvanceInterval = 64;
+
+  struct RetiredObject {
+    void *object;
+    void (*deleter)(void *);
+  };
+
+  // Per-thread state. Only 'local_epoch' is read by other threads; the
+  // padding keeps neighbouring slots off its cache line.
+  struct ThreadSlot {
+    ThreadSlot()
+        : local_epoch(kInactive), bucket_epoch{0, 0, 0}, retired_count(0),
+          freed_count(0), retires_since_advance(0) {}
+
+    atomic<uint64_t> local_epoch;
+    char padding[64 - sizeof(atomic<uint64_t>)];
+    vector<RetiredObject> buckets[kBucketCount];
+    uint64_t bucket_epoch[kBucketCount];
+    size_t retired_count;
+    size_t freed_count;
+    int retires_since_advance;
+  };
+
+  // Frees every bucket of 'slot' retired two or more epochs ago.
+  void reclaim(ThreadSlot &slot) {
+    const uint64_t epoch = global_epoch.load();
+    for (int bucket = 0; bucket < kBucketCount; bucket++) {
+      if (slot.bucket_epoch[bucket] + 2 <= epoch)
+        freeBucket(slot, bucket);
+    }
+  }
+
+  static void freeBucket(ThreadSlot &slot, int bucket) {
+    for (const RetiredObject &retired : slot.buckets[bucket])
+      retired.deleter(retired.object);
+    slot.freed_count += slot.buckets[bucket].size();
+    slot.buckets[bucket].clear();
+  }
+
+  atomic<uint64_t> global_epoch;
+  unique_ptr<ThreadSlot[]> slots;
+  int slot_count;
+};
+
+// RAII pin of one thread's epoch.
+class EpochGuard {
+public:
+  EpochGuard(EpochReclaimer &reclaimer, int thread_id)
+      : reclaimer(reclaimer), thread_id(thread_id) {
+    reclaimer.enter(thread_id);
+  }
+  ~EpochGuard() { reclaimer.exit(thread_id); }
+
+  EpochGuard(const EpochGuard &) = delete;
+  EpochGuard &operator=(const EpochGuard &) = delete;
+
+private:
+  EpochReclaimer &reclaimer;
+  int thread_id;
+};
+
+constexpr uint64_t EpochReclaimer::kInactive;
+constexpr uint64_t EpochReclaimer::kFirstEpoch;
+constexpr int EpochReclaimer::kBucketCount;
+constexpr int EpochReclaimer::kAdvanceInterval;
+
+#endif // INHA_ALGORITHM_003_EPOCH_RECLAIMER_HPP
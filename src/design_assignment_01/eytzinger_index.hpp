@@ -0,0 +1,102 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-07-03
+ *
+ * Description: Read-only search index in Eytzinger (BFS) order. The implicit
+ * tree is complete, so the children of slot k sit at 2k and 2k+1 and the
+ * descendants several levels down share a cache line, which lets the descent
+ * prefetch ahead instead of stalling on every level.
+ */
+#ifndef INHA_ALGORITHM_003_EYTZINGER_INDEX_HPP
+#define INHA_ALGORITHM_003_EYTZINGER_INDEX_HPP
+
+#include "prefetch.hpp"
+#include <cstddef>
+#include <vector>
+using namespace std;
+
+template <typename Key, typename Compare> class EytzingerIndex {
+public:
+  EytzingerIndex() : slots(1) {}
+
+  // Rebuilds the index from keys that are already sorted by Compare.
+  void build(const vector<Key> &sorted_keys) {
+    const size_t key_count = sorted_keys.size();
+    slots.assign(key_count + 1, Key());
+    ranks.assign(key_count + 1, key_count);
+    size_t next_rank = 0;
+    fill(sorted_keys, next_rank, 1);
+  }
+
+  // Number of keys in the index.
+  size_t size() const { return slots.size() - 1; }
+
+  // Heap bytes of the slot and rank arrays.
+  size_t heapBytes() const {
+    return slots.capacity() * sizeof(Key) + ranks.capacity() * sizeof(size_t);
+  }
+
+  // Number of heap blocks behind the slot and rank arrays.
+  size_t heapBlocks() const {
+    return (slots.capacity() != 0) + (ranks.capacity() != 0);
+  }
+
+  // Returns the sorted rank of the first key not less than 'key', or size()
+  // if every key is less.
+  size_t lowerBound(const Key &key) const {
+    const size_t slot_count = slots.size() - 1;
+    size_t k = 1;
+    while (k <= slot_count) {
+      // Descendants kPrefetchLevels below k are contiguous from k * stride.
+      INHA_PREFETCH(slots.data() + k * kPrefetchStride);
+      k = 2 * k + (Compare::compare(slots[k], key) < 0);
+    }
+    // Undo the trailing right turns plus the final left turn.
+    k >>= ffs(~k);
+    return ranks[k];
+  }
+
+private:
+  // Elements per cache line: the descendants that many slots from k * stride
+  // are what the descent touches a few levels down.
+  static constexpr size_t kPrefetchStride =
+      (sizeof(Key) >= 64) ? 1 : 64 / sizeof(Key);
+
+  // In-order fill: slot k receives the next sorted key after its left subtree.
+  void fill(const vector<Key> &sorted_keys, size_t &next_rank, size_t k) {
+    if (k >= slots.size())
+      return;
+    fill(sorted_keys, next_rank, 2 * k);
+    slots[k] = sorted_keys[next_rank];
+    ranks[k] = next_rank++;
+    fill(sorted_keys, next_rank, 2 * k + 1);
+  }
+
+  // Index of the lowest set bit plus one (0 when 'value' is 0).
+  static int ffs(size_t value) {
+    int position = 0;
+    while (value != 0) {
+      position++;
+      if (value & 1)
+        return position;
+      value >>= 1;
+    }
+    return 0;
+  }
+
+  // Keys in BFS order, 1-based; slot 0 is unused.
+  vector<Key> slots;
+
+  // Sorted rank of the key in each slot; ranks[0] == size() ("not found").
+  vector<size_t> ranks;
+};
+
+template <typename Key, typename Compare>
+constexpr size_t EytzingerIndex<Key, Compare>::kPrefetchStride;
+
+#endif // INHA_ALGORITHM_003_EYTZINGER_INDEX_HPP
@@ -0,0 +1,150 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-06-16
+ *
+ * Description: Optional fixed-width subject key. Names up to Width bytes are
+ * stored inline and zero-padded, so two keys compare with one or two SIMD
+ * byte-equality masks: the first differing byte decides, and the padding makes
+ * a prefix order before its extensions exactly like std::string::compare.
+ * Longer names keep their full text on the heap and only fall back to a
+ * string compare when the inline prefixes tie. Subject tokens never contain
+ * NUL bytes (the query reader splits on every byte <= ' ').
+ */
+#ifndef INHA_ALGORITHM_003_INLINE_SUBJECT_KEY_HPP
+#define INHA_ALGORITHM_003_INLINE_SUBJECT_KEY_HPP
+
+#include "basic_red_black_tree.hpp"
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <utility>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+using namespace std;
+
+template <size_t Width> class InlineSubject {
+  static_assert(Width == 16 || Width == 32, "Width must be 16 or 32 bytes");
+
+public:
+  InlineSubject() : overflow(nullptr) { memset(bytes, 0, Width); }
+
+  explicit InlineSubject(const string &subject) : overflow(nullptr) {
+    memset(bytes, 0, Width);
+    memcpy(bytes, subject.data(),
+           subject.size() < Width ? subject.size() : Width);
+    if (subject.size() > Width)
+      overflow = new string(subject);
+  }
+
+  InlineSubject(const InlineSubject &other)
+      : overflow(other.overflow ? new string(*other.overflow) : nullptr) {
+    memcpy(bytes, other.bytes, Width);
+  }
+
+  InlineSubject &operator=(const InlineSubject &other) {
+    if (this != &other) {
+      string *copied = other.overflow ? new string(*other.overflow) : nullptr;
+      delete overflow;
+      overflow = copied;
+      memcpy(bytes, other.bytes, Width);
+    }
+    return *this;
+  }
+
+  ~InlineSubject() { delete overflow; }
+
+  // Returns the subject name.
+  string toString() const {
+    if (overflow)
+      return *overflow;
+    return string(reinterpret_cast<const char *>(bytes),
+                  strnlen(reinterpret_cast<const char *>(bytes), Width));
+  }
+
+  // Whether the whole name fits in the inline block.
+  bool isInline() const { return overflow == nullptr; }
+
+  // Three-way lexicographic comparison, same order as std::string::compare.
+  static int compare(const InlineSubject &a, const InlineSubject &b) {
+    const size_t index = firstDifference(a.bytes, b.bytes);
+    if (index < Width)
+      return (a.bytes[index] < b.bytes[index]) ? kCompareLess : kCompareGreater;
+    if (!a.overflow && !b.overflow)
+      return kCompareEqual;
+
+    // Equal blocks: a name of exactly Width bytes precedes its extensions.
+    if (!a.overflow)
+      return kCompareLess;
+    if (!b.overflow)
+      return kCompareGreater;
+    const int result =
+        a.overflow->compare(Width, string::npos, *b.overflow, Width,
+                            string::npos);
+    return (result > 0) - (result < 0);
+  }
+
+private:
+  // Index of the first byte where the blocks differ, or Width if none.
+  static size_t firstDifference(const unsigned char *a,
+                                const unsigned char *b) {
+#if defined(__AVX2__)
+    if (Width == 32) {
+      const __m256i equal = _mm256_cmpeq_epi8(
+          _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a)),
+          _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b)));
+      const unsigned int mask =
+          ~static_cast<unsigned int>(_mm256_movemask_epi8(equal));
+      return (mask == 0) ? Width : static_cast<size_t>(__builtin_ctz(mask));
+    }
+#endif
+#if defined(__SSE2__)
+    for (size_t offset = 0; offset < Width; offset += 16) {
+      const __m128i equal = _mm_cmpeq_epi8(
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + offset)),
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + offset)));
+      const unsigned int mask =
+          static_cast<unsigned int>(_mm_movemask_epi8(equal)) ^ 0xFFFFu;
+      if (mask != 0)
+        return offset + static_cast<size_t>(__builtin_ctz(mask));
+    }
+    return Width;
+#else
+    size_t index = 0;
+    while (index < Width && a[index] == b[index])
+      index++;
+    return index;
+#endif
+  }
+
+  // Name bytes, zero-padded; only the first Width bytes of a long name.
+  unsigned char bytes[Width];
+
+  // Owned copy of the full name when it is longer than Width, else nullptr.
+  // A plain pointer keeps InlineSubject<16> at 32 bytes.
+  string *overflow;
+};
+
+// Comparator policy: orders composite (sid, inline subject) keys.
+template <size_t Width> struct InlineNodeKeyComparator {
+  static int compare(const pair<int, InlineSubject<Width>> &a,
+                     const pair<int, InlineSubject<Width>> &b) {
+    if (a.first != b.first) {
+      return (a.first < b.first) ? kCompareLess : kCompareGreater;
+    }
+    return InlineSubject<Width>::compare(a.second, b.second);
+  }
+};
+
+typedef pair<int, InlineSubject<16>> InlineNodeKey16;
+typedef pair<int, InlineSubject<32>> InlineNodeKey32;
+
+#endif // INHA_ALGORITHM_003_INLINE_SUBJECT_KEY_HPP
@@ -0,0 +1,160 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-07-03
+ *
+ * Description: Per-component memory accounting for the registration index.
+ * Containers count their own blocks through AccountingAllocator; tree nodes
+ * and string payloads are charged by the index when it creates them. Every
+ * update is a plain add on a counter owned by one tree, so the ledger can stay
+ * on in production.
+ */
+#ifndef INHA_ALGORITHM_003_MEMORY_LEDGER_HPP
+#define INHA_ALGORITHM_003_MEMORY_LEDGER_HPP
+
+#include <cstddef>
+#include <new>
+#include <string>
+#include <vector>
+using namespace std;
+
+enum class MemoryComponent : int {
+  // Registration tree nodes (StudentTree).
+  kTreeNodes,
+  // Nodes of the two current-timestamp indexes.
+  kIndexNodes,
+  // Nodes of the timestamp version index, one per version.
+  kVersionNodes,
+  // Heap blocks of subject strings (node keys and their map copies).
+  kKeyStrings,
+  // Heap blocks of names and phone numbers.
+  kPayloadStrings,
+  // Storage of the per-sid and per-subject vectors.
+  kIndexVectors,
+  // Nodes of sid_map and subject_map.
+  kMapNodes,
+  // Arrays of the frozen L/C/M layout.
+  kFrozenLayout
+};
+
+// Number of MemoryComponent values.
+static constexpr int kMemoryComponentCount = 8;
+
+// Live bytes and live objects (allocations) of one component.
+struct MemoryCounter {
+  size_t bytes = 0;
+  size_t objects = 0;
+};
+
+// One component of a memory report.
+struct MemoryUsage {
+  const char *component;
+  size_t bytes;
+  size_t objects;
+};
+
+class MemoryLedger {
+public:
+  // Charges 'bytes' over 'objects' allocations to 'component'.
+  void add(MemoryComponent component, size_t bytes, size_t objects = 1) {
+    MemoryCounter &counter = counters[static_cast<int>(component)];
+    counter.bytes += bytes;
+    counter.objects += objects;
+  }
+
+  // Releases what add() charged.
+  void remove(MemoryComponent component, size_t bytes, size_t objects = 1) {
+    MemoryCounter &counter = counters[static_cast<int>(component)];
+    counter.bytes -= bytes;
+    counter.objects -= objects;
+  }
+
+  // Counter of one component (allocators keep a pointer to it).
+  MemoryCounter &counter(MemoryComponent component) {
+    return counters[static_cast<int>(component)];
+  }
+
+  // Appends one MemoryUsage per component to 'usage'.
+  void report(vector<MemoryUsage> &usage) const {
+    for (int i = 0; i < kMemoryComponentCount; i++) {
+      usage.push_back(MemoryUsage{kComponentNames[i], counters[i].bytes,
+                                  counters[i].objects});
+    }
+  }
+
+  // Bytes of the heap block behind 's' (0 while it fits the inline buffer).
+  static size_t stringHeapBytes(const string &s) {
+    static const size_t inline_capacity = string().capacity();
+    return (s.capacity() > inline_capacity) ? s.capacity() + 1 : 0;
+  }
+
+  // Bytes of the heap block behind 'v'.
+  template <typename T, typename Allocator>
+  static size_t vectorHeapBytes(const vector<T, Allocator> &v) {
+    return v.capacity() * sizeof(T);
+  }
+
+  // Report name of each component, in MemoryComponent order.
+  static constexpr const char *kComponentNames[kMemoryComponentCount] = {
+      "tree_nodes",      "index_nodes",   "version_nodes", "key_strings",
+      "payload_strings", "index_vectors", "map_nodes",     "frozen_layout"};
+
+private:
+  MemoryCounter counters[kMemoryComponentCount];
+};
+
+constexpr const char *MemoryLedger::kComponentNames[kMemoryComponentCount];
+
+// Allocator that charges every block to a MemoryCounter. Copies (including
+// rebound ones) share the counter; a default-constructed allocator counts
+// nothing.
+template <typename T> class AccountingAllocator {
+public:
+  typedef T value_type;
+
+  AccountingAllocator() noexcept : counter(nullptr) {}
+  explicit AccountingAllocator(MemoryCounter *counter) noexcept
+      : counter(counter) {}
+  template <typename U>
+  AccountingAllocator(const AccountingAllocator<U> &other) noexcept
+      : counter(other.getCounter()) {}
+
+  T *allocate(size_t n) {
+    if (counter != nullptr) {
+      counter->bytes += n * sizeof(T);
+      counter->objects++;
+    }
+    return static_cast<T *>(::operator new(n * sizeof(T)));
+  }
+
+  void deallocate(T *ptr, size_t n) noexcept {
+    if (counter != nullptr) {
+      counter->bytes -= n * sizeof(T);
+      counter->objects--;
+    }
+    ::operator delete(ptr);
+  }
+
+  MemoryCounter *getCounter() const noexcept { return counter; }
+
+private:
+  MemoryCounter *counter;
+};
+
+template <typename T, typename U>
+inline bool operator==(const AccountingAllocator<T> &a,
+                       const AccountingAllocator<U> &b) noexcept {
+  return a.getCounter() == b.getCounter();
+}
+
+template <typename T, typename U>
+inline bool operator!=(const AccountingAllocator<T> &a,
+                       const AccountingAllocator<U> &b) noexcept {
+  return !(a == b);
+}
+
+#endif // INHA_ALGORITHM_003_MEMORY_LEDGER_HPP
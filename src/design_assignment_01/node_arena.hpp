@@ -0,0 +1,141 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-07-03
+ *
+ * Description: Bump-pointer arena for tree nodes. Blocks are kept across
+ * reset() so that a worker can reuse the same memory for many trees. Nodes
+ * freed before the reset (e.g. by re-timestamp erases) go on a free list per
+ * node size and are handed out again first, so a long run of updates does
+ * not keep growing the arena.
+ */
+#ifndef INHA_ALGORITHM_003_NODE_ARENA_HPP
+#define INHA_ALGORITHM_003_NODE_ARENA_HPP
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <utility>
+#include <vector>
+using namespace std;
+
+class NodeArena {
+public:
+  explicit NodeArena(size_t block_size = kDefaultBlockSize)
+      : block_size(block_size), cur_block(0), cur_offset(0) {}
+  ~NodeArena() {
+    for (const ArenaBlock &block : blocks)
+      free(block.first);
+  }
+
+  NodeArena(const NodeArena &) = delete;
+  NodeArena &operator=(const NodeArena &) = delete;
+
+  // Returns 'size' bytes aligned to 'alignment' (a power of two).
+  void *allocate(size_t size, size_t alignment) {
+    FreeList *free_list = findFreeList(size, alignment);
+    if (free_list != nullptr && free_list->head != nullptr) {
+      FreeChunk *chunk = free_list->head;
+      free_list->head = chunk->next;
+      return chunk;
+    }
+
+    for (; cur_block < blocks.size(); cur_block++, cur_offset = 0) {
+      size_t aligned = (cur_offset + alignment - 1) & ~(alignment - 1);
+      if (aligned + size <= blocks[cur_block].second) {
+        cur_offset = aligned + size;
+        return blocks[cur_block].first + aligned;
+      }
+    }
+
+    // Every block is in use: grab a new one (oversized requests included).
+    size_t new_block_size = (size > block_size) ? size : block_size;
+    char *block = static_cast<char *>(malloc(new_block_size));
+    if (block == nullptr)
+      throw bad_alloc();
+    blocks.push_back(ArenaBlock(block, new_block_size));
+    cur_offset = size;
+    return block;
+  }
+
+  // Takes back 'memory' returned by allocate(size, alignment), whose object
+  // is already destroyed, for the next allocation of the same shape.
+  void deallocate(void *memory, size_t size, size_t alignment) {
+    if (size < sizeof(FreeChunk))
+      return;
+    FreeList *free_list = findFreeList(size, alignment);
+    if (free_list == nullptr) {
+      free_lists.push_back(FreeList{size, alignment, nullptr});
+      free_list = &free_lists.back();
+    }
+    FreeChunk *chunk = static_cast<FreeChunk *>(memory);
+    chunk->next = free_list->head;
+    free_list->head = chunk;
+  }
+
+  // Makes every block available again. Objects must already be destroyed.
+  void reset() {
+    cur_block = 0;
+    cur_offset = 0;
+    free_lists.clear();
+  }
+
+  // Total bytes reserved by the arena.
+  size_t reservedBytes() const {
+    size_t total = 0;
+    for (const ArenaBlock &block : blocks)
+      total += block.second;
+    return total;
+  }
+
+private:
+  static constexpr size_t kDefaultBlockSize = 1 << 20;
+
+  // A freed allocation, linked through its own first bytes.
+  struct FreeChunk {
+    FreeChunk *next;
+  };
+
+  // Freed allocations of one size and alignment.
+  struct FreeList {
+    size_t size;
+    size_t alignment;
+    FreeChunk *head;
+  };
+
+  // Returns the free list for 'size' and 'alignment', or nullptr. A tree
+  // allocates only a few node types, so a linear scan is enough.
+  FreeList *findFreeList(size_t size, size_t alignment) {
+    for (FreeList &free_list : free_lists) {
+      if (free_list.size == size && free_list.alignment == alignment)
+        return &free_list;
+    }
+    return nullptr;
+  }
+
+  // A block of raw memory and its size in bytes.
+  typedef pair<char *, size_t> ArenaBlock;
+
+  // Size of each regular block in bytes.
+  size_t block_size;
+
+  // Blocks owned by the arena, in allocation order.
+  vector<ArenaBlock> blocks;
+
+  // Index of the block currently being carved.
+  size_t cur_block;
+
+  // Offset of the next free byte inside the current block.
+  size_t cur_offset;
+
+  // Freed allocations by shape, reused before carving new memory
+  vector<FreeList> free_lists;
+};
+
+constexpr size_t NodeArena::kDefaultBlockSize;
+
+#endif // INHA_ALGORITHM_003_NODE_ARENA_HPP
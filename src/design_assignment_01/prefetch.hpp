@@ -0,0 +1,22 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-06-17
+ *
+ * Description: Software prefetch hint shared by the search structures.
+ */
+#ifndef INHA_ALGORITHM_003_PREFETCH_HPP
+#define INHA_ALGORITHM_003_PREFETCH_HPP
+
+// Hint the CPU to fetch 'address' into cache ahead of use.
+#if defined(__GNUC__) || defined(__clang__)
+#define INHA_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define INHA_PREFETCH(address) ((void)(address))
+#endif
+
+#endif // INHA_ALGORITHM_003_PREFETCH_HPP
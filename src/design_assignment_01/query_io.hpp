@@ -0,0 +1,401 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-07-03
+ *
+ * Description: Buffered query tokenizer and response formatter for the
+ * registration index. Both sides work on large blocks so that a stage never
+ * pays one syscall per line.
+ */
+#ifndef INHA_ALGORITHM_003_QUERY_IO_HPP
+#define INHA_ALGORITHM_003_QUERY_IO_HPP
+
+#include "red_black_tree.hpp"
+#include <climits>
+#include <cstdio>
+#include <string>
+#include <vector>
+using namespace std;
+
+// Reads whitespace-separated query tokens from a FILE* in large blocks.
+class QueryReader {
+public:
+  explicit QueryReader(FILE *input)
+      : input(input), buffer(kBufferSize), buffer_pos(0), buffer_end(0) {}
+
+  // Reads the leading query count. Returns false on end of input.
+  bool readCount(int &count) { return readInt(count); }
+
+  // Reads the next query line into 'query', counting it against
+  // 'remaining'. A line with an unknown query type is skipped whole and
+  // counts as one query. This deliberately differs from the original cin
+  // loop, which read only the type character and then took each following
+  // token as a new query. Returns false once 'remaining' reaches zero, at end
+  // of input, or on a malformed query.
+  bool readQuery(Query &query, int &remaining) {
+    string type_token;
+    while (remaining > 0) {
+      if (!readToken(type_token)) {
+        return false;
+      }
+      remaining--;
+      if (type_token.size() == 1 && isQueryType(type_token[0])) {
+        break;
+      }
+      skipLine();
+      if (remaining == 0) {
+        return false;
+      }
+    }
+    if (type_token.empty()) {
+      return false;
+    }
+    query.type = static_cast<QueryType>(type_token[0]);
+
+    switch (query.type) {
+    case QueryType::kInsert:
+      return readInt(query.sid) && readToken(query.subject) &&
+             readToken(query.sname) && readInt(query.semester) &&
+             readToken(query.phone) && readInt(query.timestamp);
+    case QueryType::kListSubjects:
+      return readInt(query.sid);
+    case QueryType::kCountStudents:
+      return readToken(query.subject);
+    case QueryType::kEarliestApplicants:
+    case QueryType::kGlobalEarliestApplicants:
+      return readToken(query.subject) && readInt(query.k);
+    case QueryType::kEarliestApplicantsAsOf:
+      return readToken(query.subject) && readInt(query.k) &&
+             readInt(query.timestamp);
+    case QueryType::kFreeze:
+    case QueryType::kThaw:
+    case QueryType::kMemoryReport:
+      return true;
+    }
+    return false;
+  }
+
+  // Reads the next whitespace-separated token. Returns false on end of input.
+  bool readToken(string &token) {
+    token.clear();
+    int ch = skipWhitespace();
+    if (ch < 0) {
+      return false;
+    }
+    while (ch > ' ') {
+      token.push_back(static_cast<char>(ch));
+      buffer_pos++;
+      ch = peekChar();
+    }
+    return true;
+  }
+
+  // Reads the next token as a (possibly negative) decimal integer. Returns
+  // false at end of input, if the token does not start with a digit, or if
+  // its magnitude exceeds INT_MAX.
+  bool readInt(int &value) {
+    int ch = skipWhitespace();
+    if (ch < 0) {
+      return false;
+    }
+    bool negative = (ch == '-');
+    if (negative) {
+      buffer_pos++;
+      ch = peekChar();
+    }
+    if (ch < '0' || ch > '9') {
+      return false;
+    }
+    int result = 0;
+    while (ch >= '0' && ch <= '9') {
+      if (result > (INT_MAX - (ch - '0')) / 10) {
+        return false;
+      }
+      result = result * 10 + (ch - '0');
+      buffer_pos++;
+      ch = peekChar();
+    }
+    value = negative ? -result : result;
+    return true;
+  }
+
+private:
+  static constexpr size_t kBufferSize = 1 << 16;
+
+  // Returns the next character without consuming it, or -1 at end of input.
+  int peekChar() {
+    if (buffer_pos == buffer_end) {
+      buffer_end = fread(buffer.data(), 1, buffer.size(), input);
+      buffer_pos = 0;
+      if (buffer_end == 0) {
+        return -1;
+      }
+    }
+    return static_cast<unsigned char>(buffer[buffer_pos]);
+  }
+
+  // Whether 'letter' names a query type the tree executes.
+  static bool isQueryType(char letter) {
+    switch (static_cast<QueryType>(letter)) {
+    case QueryType::kInsert:
+    case QueryType::kListSubjects:
+    case QueryType::kCountStudents:
+    case QueryType::kEarliestApplicants:
+    case QueryType::kGlobalEarliestApplicants:
+    case QueryType::kEarliestApplicantsAsOf:
+    case QueryType::kFreeze:
+    case QueryType::kThaw:
+    case QueryType::kMemoryReport:
+      return true;
+    }
+    return false;
+  }
+
+  // Consumes the rest of the current line, including its newline.
+  void skipLine() {
+    int ch = peekChar();
+    while (ch >= 0 && ch != '\n') {
+      buffer_pos++;
+      ch = peekChar();
+    }
+    if (ch == '\n') {
+      buffer_pos++;
+    }
+  }
+
+  // Skips whitespace and returns the first character of the next token.
+  int skipWhitespace() {
+    int ch = peekChar();
+    while (ch >= 0 && ch <= ' ') {
+      buffer_pos++;
+      ch = peekChar();
+    }
+    return ch;
+  }
+
+  FILE *input;
+  vector<char> buffer;
+  size_t buffer_pos;
+  size_t buffer_end;
+};
+
+// Parses one query line held in memory ("I sid subject ..."), e.g. a line
+// received by the query server. Returns false on a malformed line.
+inline bool parseQueryLine(const char *begin, const char *end, Query &query) {
+  const char *cursor = begin;
+
+  // Returns the next whitespace-separated token as [token_begin, cursor).
+  auto nextToken = [&](const char *&token_begin) {
+    while (cursor < end && static_cast<unsigned char>(*cursor) <= ' ')
+      cursor++;
+    token_begin = cursor;
+    while (cursor < end && static_cast<unsigned char>(*cursor) > ' ')
+      cursor++;
+    return cursor > token_begin;
+  };
+  auto readToken = [&](string &token) {
+    const char *token_begin;
+    if (!nextToken(token_begin))
+      return false;
+    token.assign(token_begin, cursor);
+    return true;
+  };
+  auto readInt = [&](int &value) {
+    const char *token_begin;
+    if (!nextToken(token_begin))
+      return false;
+    bool negative = (*token_begin == '-');
+    if (token_begin + negative == cursor)
+      return false;
+    int result = 0;
+    for (const char *ch = token_begin + negative; ch < cursor; ch++) {
+      if (*ch < '0' || *ch > '9' || result > (INT_MAX - (*ch - '0')) / 10)
+        return false;
+      result = result * 10 + (*ch - '0');
+    }
+    value = negative ? -result : result;
+    return true;
+  };
+
+  const char *type_begin;
+  if (!nextToken(type_begin) || cursor - type_begin != 1) {
+    return false;
+  }
+  query.type = static_cast<QueryType>(*type_begin);
+
+  bool parsed = false;
+  switch (query.type) {
+  case QueryType::kInsert:
+    parsed = readInt(query.sid) && readToken(query.subject) &&
+             readToken(query.sname) && readInt(query.semester) &&
+             readToken(query.phone) && readInt(query.timestamp);
+    break;
+  case QueryType::kListSubjects:
+    parsed = readInt(query.sid);
+    break;
+  case QueryType::kCountStudents:
+    parsed = readToken(query.subject);
+    break;
+  case QueryType::kEarliestApplicants:
+  case QueryType::kGlobalEarliestApplicants:
+    parsed = readToken(query.subject) && readInt(query.k);
+    break;
+  case QueryType::kEarliestApplicantsAsOf:
+    parsed = readToken(query.subject) && readInt(query.k) &&
+             readInt(query.timestamp);
+    break;
+  case QueryType::kFreeze:
+  case QueryType::kThaw:
+  case QueryType::kMemoryReport:
+    parsed = true;
+    break;
+  }
+
+  // Trailing tokens make the line malformed.
+  const char *extra_begin;
+  return parsed && !nextToken(extra_begin);
+}
+
+// Formats query responses into a byte buffer, byte-identical to the original
+// "cout << ..." output of each query type.
+class ResponseFormatter {
+public:
+  // Appends the text of 'response' (one line) to 'out'.
+  static void append(string &out, const QueryResponse &response) {
+    if (response.status == ResponseStatus::kNoRecordsFound) {
+      out += RedBlackTree::kNoRecordsFoundMessage;
+      out += '\n';
+      return;
+    }
+    if (response.status == ResponseStatus::kUnexpectedError) {
+      out += RedBlackTree::kUnexpectedErrorMessage;
+      out += '\n';
+      return;
+    }
+
+    switch (response.type) {
+    case QueryType::kInsert:
+    case QueryType::kCountStudents:
+      appendInt(out, response.first_value);
+      out += ' ';
+      appendInt(out, response.second_value);
+      break;
+    case QueryType::kFreeze:
+    case QueryType::kThaw:
+      appendInt(out, response.first_value);
+      break;
+    case QueryType::kMemoryReport: {
+      // "<component> <bytes> <objects> ..." then "total <bytes>".
+      size_t total_bytes = 0;
+      for (const MemoryUsage &usage : response.memory_usage) {
+        out += usage.component;
+        out += ' ';
+        appendSize(out, usage.bytes);
+        out += ' ';
+        appendSize(out, usage.objects);
+        out += ' ';
+        total_bytes += usage.bytes;
+      }
+      out += "total ";
+      appendSize(out, total_bytes);
+      break;
+    }
+    case QueryType::kListSubjects:
+    case QueryType::kEarliestApplicants:
+    case QueryType::kEarliestApplicantsAsOf:
+      for (const ResponseEntry &entry : response.entries) {
+        if (entry.subject != nullptr)
+          out += *entry.subject;
+        else
+          appendInt(out, entry.sid);
+        out += ' ';
+        out += entry.color;
+        out += ' ';
+      }
+      break;
+    case QueryType::kGlobalEarliestApplicants:
+      for (const ResponseEntry &entry : response.entries) {
+        appendInt(out, entry.sid);
+        out += ' ';
+        out += *entry.subject;
+        out += ' ';
+        out += entry.color;
+        out += ' ';
+      }
+      break;
+    }
+    out += '\n';
+  }
+
+  // Appends the decimal text of an unsigned size.
+  static void appendSize(string &out, size_t value) {
+    char digits[24];
+    int length = 0;
+    do {
+      digits[length++] = static_cast<char>('0' + value % 10);
+      value /= 10;
+    } while (value != 0);
+    while (length > 0)
+      out += digits[--length];
+  }
+
+  // Appends the decimal text of 'value' without going through iostreams.
+  static void appendInt(string &out, int value) {
+    char digits[12];
+    int length = 0;
+    unsigned int magnitude = (value < 0) ? 0u - static_cast<unsigned int>(value)
+                                         : static_cast<unsigned int>(value);
+    do {
+      digits[length++] = static_cast<char>('0' + magnitude % 10);
+      magnitude /= 10;
+    } while (magnitude != 0);
+    if (value < 0)
+      out += '-';
+    while (length > 0)
+      out += digits[--length];
+  }
+};
+
+// Accumulates formatted responses and writes them to a FILE* in bulk.
+class ResponseWriter {
+public:
+  explicit ResponseWriter(FILE *output) : output(output) {
+    buffer.reserve(kFlushThreshold + 4096);
+  }
+  ~ResponseWriter() { flush(); }
+
+  ResponseWriter(const ResponseWriter &) = delete;
+  ResponseWriter &operator=(const ResponseWriter &) = delete;
+
+  // Formats 'response', flushing once the buffer passes the threshold.
+  void write(const QueryResponse &response) {
+    ResponseFormatter::append(buffer, response);
+    if (buffer.size() >= kFlushThreshold) {
+      flush();
+    }
+  }
+
+  // Writes every buffered byte to the output.
+  void flush() {
+    if (!buffer.empty()) {
+      fwrite(buffer.data(), 1, buffer.size(), output);
+      buffer.clear();
+    }
+    fflush(output);
+  }
+
+private:
+  static constexpr size_t kFlushThreshold = 1 << 16;
+
+  FILE *output;
+  string buffer;
+};
+
+constexpr size_t QueryReader::kBufferSize;
+constexpr size_t ResponseWriter::kFlushThreshold;
+
+#endif // INHA_ALGORITHM_003_QUERY_IO_HPP
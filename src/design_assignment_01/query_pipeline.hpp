@@ -0,0 +1,150 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-06-18
+ *
+ * Description: Three-stage query driver. A reader thread tokenizes queries,
+ * the calling thread executes them against RedBlackTree, and a writer thread
+ * formats and flushes the responses. Stages exchange batches through SPSC
+ * rings, so parsing and formatting overlap with tree work. Both drivers hand
+ * whole batches to a QueryPlanner, so repeated reads in a run are coalesced
+ * and the remaining lookups use interleaved descents.
+ */
+#ifndef INHA_ALGORITHM_003_QUERY_PIPELINE_HPP
+#define INHA_ALGORITHM_003_QUERY_PIPELINE_HPP
+
+#include "query_io.hpp"
+#include "query_planner.hpp"
+#include "red_black_tree.hpp"
+#include "spsc_ring.hpp"
+#include <cstdio>
+#include <thread>
+#include <vector>
+using namespace std;
+
+// A batch of parsed queries; an empty batch marks the end of the input.
+typedef vector<Query> QueryBatch;
+
+// A batch of executed responses; an empty batch marks the end of the output.
+typedef vector<QueryResponse> ResponseBatch;
+
+struct PipelineOptions {
+  // Number of queries handed between stages at once.
+  size_t batch_size = 1024;
+
+  // Number of batches each ring can hold before the producer waits.
+  size_t ring_capacity = 64;
+};
+
+// Number of queries the sequential driver reads ahead before executing.
+static constexpr size_t kSequentialWindow = 64;
+
+// Runs the sequential driver: parse, execute and format a small window of
+// queries at a time on the calling thread. The planner's counters are added
+// to 'planner_stats' when given.
+inline void runSequential(RedBlackTree &tree, FILE *input, FILE *output,
+                          PlannerStats *planner_stats = nullptr) {
+  QueryReader reader(input);
+  ResponseWriter writer(output);
+  QueryPlanner planner(tree);
+
+  // Enter test cases.
+  int test_case = 0;
+  reader.readCount(test_case);
+
+  QueryBatch queries(kSequentialWindow);
+  ResponseBatch responses(kSequentialWindow);
+  while (test_case > 0) {
+    size_t query_count = 0;
+    while (query_count < kSequentialWindow &&
+           reader.readQuery(queries[query_count], test_case)) {
+      query_count++;
+    }
+    if (query_count == 0) {
+      break;
+    }
+    planner.execute(queries.data(), query_count, responses.data());
+    for (size_t i = 0; i < query_count; i++) {
+      writer.write(responses[i]);
+    }
+    if (query_count < kSequentialWindow && test_case > 0) {
+      break;
+    }
+  }
+  if (planner_stats != nullptr) {
+    *planner_stats += planner.stats();
+  }
+}
+
+// Runs the three-stage pipelined driver over the same input format.
+inline void runPipeline(RedBlackTree &tree, FILE *input, FILE *output,
+                        const PipelineOptions &options,
+                        PlannerStats *planner_stats = nullptr) {
+  const size_t batch_size = (options.batch_size == 0) ? 1 : options.batch_size;
+  SpscRing<QueryBatch> query_ring(options.ring_capacity);
+  SpscRing<ResponseBatch> response_ring(options.ring_capacity);
+
+  // Stage 1: tokenize queries into batches.
+  thread reader_thread([&]() {
+    QueryReader reader(input);
+    int test_case = 0;
+    reader.readCount(test_case);
+
+    QueryBatch batch;
+    batch.reserve(batch_size);
+    Query query;
+    while (reader.readQuery(query, test_case)) {
+      batch.push_back(move(query));
+      if (batch.size() == batch_size) {
+        query_ring.push(move(batch));
+        batch = QueryBatch();
+        batch.reserve(batch_size);
+      }
+    }
+    if (!batch.empty()) {
+      query_ring.push(move(batch));
+    }
+    query_ring.push(QueryBatch());
+  });
+
+  // Stage 3: format and flush responses.
+  thread writer_thread([&]() {
+    ResponseWriter writer(output);
+    ResponseBatch batch;
+    while (true) {
+      response_ring.pop(batch);
+      if (batch.empty()) {
+        break;
+      }
+      for (const QueryResponse &response : batch) {
+        writer.write(response);
+      }
+    }
+  });
+
+  // Stage 2: execute against the tree on the calling thread.
+  QueryPlanner planner(tree);
+  QueryBatch queries;
+  while (true) {
+    query_ring.pop(queries);
+    if (queries.empty()) {
+      break;
+    }
+    ResponseBatch responses(queries.size());
+    planner.execute(queries.data(), queries.size(), responses.data());
+    response_ring.push(move(responses));
+  }
+  response_ring.push(ResponseBatch());
+
+  reader_thread.join();
+  writer_thread.join();
+  if (planner_stats != nullptr) {
+    *planner_stats += planner.stats();
+  }
+}
+
+#endif // INHA_ALGORITHM_003_QUERY_PIPELINE_HPP
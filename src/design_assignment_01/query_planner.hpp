@@ -0,0 +1,171 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-07-03
+ *
+ * Description: Query-batch planner for the drivers. Inside each run of
+ * consecutive read queries it groups the queries that ask the same thing
+ * (L by sid, C by subject, E by prefix, A by subject and time), executes one
+ * representative per group with the largest K, and answers the rest by
+ * copying or slicing its result. Responses keep the input order. M is never
+ * grouped: it re-sorts the subject's vector in place, so tied timestamps can
+ * come out in a new order on every M, and each one runs on its own.
+ */
+#ifndef INHA_ALGORITHM_003_QUERY_PLANNER_HPP
+#define INHA_ALGORITHM_003_QUERY_PLANNER_HPP
+
+#include "red_black_tree.hpp"
+#include <cstddef>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+using namespace std;
+
+// Coalescing counters of a QueryPlanner.
+struct PlannerStats {
+  // Read queries seen inside read runs.
+  size_t read_queries = 0;
+
+  // Read queries executed against the tree (one per group).
+  size_t computed_queries = 0;
+
+  // Read queries answered from another query's result.
+  size_t coalesced_queries = 0;
+
+  // Runs of consecutive read queries planned.
+  size_t read_runs = 0;
+
+  PlannerStats &operator+=(const PlannerStats &other) {
+    read_queries += other.read_queries;
+    computed_queries += other.computed_queries;
+    coalesced_queries += other.coalesced_queries;
+    read_runs += other.read_runs;
+    return *this;
+  }
+};
+
+class QueryPlanner {
+public:
+  explicit QueryPlanner(RedBlackTree &tree) : tree(tree) {}
+
+  // Executes queries[0, count) in order into 'responses', coalescing the
+  // repeated reads inside each read run.
+  void execute(const Query *queries, size_t count, QueryResponse *responses) {
+    size_t run_begin = 0;
+    for (size_t i = 0; i <= count; i++) {
+      if (i < count && !RedBlackTree::isMutating(queries[i].type))
+        continue;
+      executeReadRun(queries, run_begin, i, responses);
+      if (i < count)
+        tree.execute(queries[i], responses[i]);
+      run_begin = i + 1;
+    }
+  }
+
+  // Counters accumulated since construction.
+  const PlannerStats &stats() const { return planner_stats; }
+
+private:
+  // What a read query asks for: (type, sid, subject or prefix, as-of time).
+  typedef tuple<char, int, string, int> GroupKey;
+
+  // Returns the group a read query belongs to.
+  static GroupKey makeGroupKey(const Query &query) {
+    switch (query.type) {
+    case QueryType::kListSubjects:
+      return GroupKey(static_cast<char>(query.type), query.sid, string(), 0);
+    case QueryType::kEarliestApplicantsAsOf:
+      return GroupKey(static_cast<char>(query.type), 0, query.subject,
+                      query.timestamp);
+    default:
+      return GroupKey(static_cast<char>(query.type), 0, query.subject, 0);
+    }
+  }
+
+  // Whether a query may share the result of an equal one in its run.
+  static bool isCoalescable(QueryType type) {
+    return type != QueryType::kEarliestApplicants;
+  }
+
+  // Whether a smaller K is answered by the first K entries of a larger one
+  // (the orders of these queries have no ties).
+  static bool isSliceable(QueryType type) {
+    return type == QueryType::kGlobalEarliestApplicants ||
+           type == QueryType::kEarliestApplicantsAsOf;
+  }
+
+  // Plans and executes the read queries queries[begin, end).
+  void executeReadRun(const Query *queries, size_t begin, size_t end,
+                      QueryResponse *responses) {
+    if (begin == end)
+      return;
+
+    // Group the run; each group's representative asks for the largest K.
+    // Every M is a group of its own, executed in input order.
+    group_index.clear();
+    representatives.clear();
+    query_groups.resize(end - begin);
+    for (size_t i = begin; i < end; i++) {
+      if (!isCoalescable(queries[i].type)) {
+        query_groups[i - begin] = representatives.size();
+        representatives.push_back(queries[i]);
+        continue;
+      }
+      pair<map<GroupKey, size_t>::iterator, bool> inserted =
+          group_index.insert(
+              make_pair(makeGroupKey(queries[i]), representatives.size()));
+      if (inserted.second) {
+        representatives.push_back(queries[i]);
+      } else {
+        Query &representative = representatives[inserted.first->second];
+        if (queries[i].k > representative.k)
+          representative.k = queries[i].k;
+      }
+      query_groups[i - begin] = inserted.first->second;
+    }
+
+    representative_responses.resize(representatives.size());
+    tree.executeBatch(representatives.data(), representatives.size(),
+                      representative_responses.data());
+
+    // Hand every query its group's result, cut down to its own K.
+    for (size_t i = begin; i < end; i++) {
+      const QueryResponse &computed =
+          representative_responses[query_groups[i - begin]];
+      QueryResponse &response = responses[i];
+      response.type = computed.type;
+      response.status = computed.status;
+      response.first_value = computed.first_value;
+      response.second_value = computed.second_value;
+      size_t entry_count = computed.entries.size();
+      if (isSliceable(queries[i].type)) {
+        const size_t k = (queries[i].k < 0) ? 0 : queries[i].k;
+        entry_count = (k < entry_count) ? k : entry_count;
+      }
+      response.entries.assign(computed.entries.begin(),
+                              computed.entries.begin() + entry_count);
+      response.memory_usage = computed.memory_usage;
+    }
+
+    planner_stats.read_runs++;
+    planner_stats.read_queries += end - begin;
+    planner_stats.computed_queries += representatives.size();
+    planner_stats.coalesced_queries += (end - begin) - representatives.size();
+  }
+
+  RedBlackTree &tree;
+  PlannerStats planner_stats;
+
+  // Scratch space reused across runs.
+  map<GroupKey, size_t> group_index;
+  vector<Query> representatives;
+  vector<QueryResponse> representative_responses;
+  vector<size_t> query_groups;
+};
+
+#endif // INHA_ALGORITHM_003_QUERY_PLANNER_HPP
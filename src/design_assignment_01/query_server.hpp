@@ -0,0 +1,341 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-07-03
+ *
+ * Description: Long-running query server. One resident RedBlackTree answers
+ * I/L/C/M lines from many clients over a Unix domain socket. A single epoll
+ * loop owns the tree, so no locking is needed. Clients may pipeline any
+ * number of lines; every line gets exactly one response line, in order, and
+ * the responses to one read are written back together. Each event reads at
+ * most one chunk, so a flooding client cannot starve the others, and a client
+ * is not read while more than kMaxPendingOutput bytes of its responses wait
+ * to be sent. A client whose unterminated line outgrows kMaxLineBytes is
+ * dropped. After a client half-closes, only its remaining output is watched.
+ * (Linux only.)
+ */
+#ifndef INHA_ALGORITHM_003_QUERY_SERVER_HPP
+#define INHA_ALGORITHM_003_QUERY_SERVER_HPP
+
+#include "query_io.hpp"
+#include "red_black_tree.hpp"
+#include <cerrno>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <map>
+#include <string>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+using namespace std;
+
+// Message: Sent back for a line that is not a valid I/L/C/M query.
+static constexpr const char *kInvalidQueryMessage = "Invalid query";
+
+// Set by SIGINT/SIGTERM to stop the server loop.
+static volatile sig_atomic_t server_stop_requested = 0;
+
+class QueryServer {
+public:
+  QueryServer(RedBlackTree &tree, const string &socket_path)
+      : tree(tree), socket_path(socket_path), listen_fd(-1), epoll_fd(-1) {}
+  ~QueryServer() {
+    for (map<int, ClientState>::iterator it = clients.begin();
+         it != clients.end(); ++it)
+      close(it->first);
+    if (listen_fd >= 0) {
+      close(listen_fd);
+      unlink(socket_path.c_str());
+    }
+    if (epoll_fd >= 0)
+      close(epoll_fd);
+  }
+
+  QueryServer(const QueryServer &) = delete;
+  QueryServer &operator=(const QueryServer &) = delete;
+
+  // Serves clients until SIGINT/SIGTERM. Returns false if the socket cannot
+  // be set up.
+  bool run() {
+    if (!openListener()) {
+      return false;
+    }
+    installSignalHandlers();
+
+    while (!server_stop_requested) {
+      if (!serveEvents(-1))
+        return false;
+    }
+    return true;
+  }
+
+  // Waits up to 'timeout_ms' (-1: no limit) for socket events and handles
+  // them. Returns false if epoll fails.
+  bool serveEvents(int timeout_ms) {
+    epoll_event events[kMaxEvents];
+    int ready = epoll_wait(epoll_fd, events, kMaxEvents, timeout_ms);
+    if (ready < 0) {
+      if (errno == EINTR)
+        return true;
+      perror("epoll_wait");
+      return false;
+    }
+    for (int i = 0; i < ready; i++) {
+      const int fd = events[i].data.fd;
+      if (fd == listen_fd) {
+        acceptClients();
+        continue;
+      }
+      bool keep_open = true;
+      if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+        keep_open = readClient(fd);
+      if (keep_open && (events[i].events & EPOLLOUT))
+        keep_open = flushClient(fd);
+      if (!keep_open)
+        closeClient(fd);
+    }
+    return true;
+  }
+
+  // Serves an already connected socket (e.g. one end of a socketpair) as a
+  // client; the server closes it. Returns false if it cannot be watched.
+  bool addClient(int client_fd) {
+    if (!openEpoll() || !setNonBlocking(client_fd)) {
+      close(client_fd);
+      return false;
+    }
+    epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.fd = client_fd;
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, client_fd, &event) < 0) {
+      close(client_fd);
+      return false;
+    }
+    clients[client_fd] = ClientState();
+    return true;
+  }
+
+private:
+  static constexpr int kMaxEvents = 64;
+  static constexpr size_t kReadChunk = 1 << 16;
+
+  // Longest line a client may send; no valid query comes close.
+  static constexpr size_t kMaxLineBytes = 1 << 16;
+
+  // Unsent response bytes above which a client is not read.
+  static constexpr size_t kMaxPendingOutput = 1 << 20;
+
+  // Per-connection buffers.
+  struct ClientState {
+    // Bytes received but not yet terminated by '\n'.
+    string input;
+
+    // Formatted responses not yet accepted by the socket.
+    string output;
+
+    // Events currently requested from epoll for this client.
+    uint32_t watched_events = EPOLLIN;
+
+    // Whether the client has shut down its write side.
+    bool peer_closed = false;
+  };
+
+  static void handleStopSignal(int) { server_stop_requested = 1; }
+
+  // Installs SIGINT/SIGTERM handlers (without SA_RESTART, so epoll_wait
+  // wakes up) and ignores SIGPIPE from clients that went away.
+  static void installSignalHandlers() {
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = handleStopSignal;
+    sigaction(SIGINT, &action, nullptr);
+    sigaction(SIGTERM, &action, nullptr);
+    signal(SIGPIPE, SIG_IGN);
+  }
+
+  static bool setNonBlocking(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+  }
+
+  bool openListener() {
+    sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(address.sun_path)) {
+      fprintf(stderr, "Socket path too long: %s\n", socket_path.c_str());
+      return false;
+    }
+    strcpy(address.sun_path, socket_path.c_str());
+
+    listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd < 0) {
+      perror("socket");
+      return false;
+    }
+    unlink(socket_path.c_str());
+    if (bind(listen_fd, reinterpret_cast<sockaddr *>(&address),
+             sizeof(address)) < 0 ||
+        listen(listen_fd, SOMAXCONN) < 0 || !setNonBlocking(listen_fd)) {
+      perror("bind/listen");
+      return false;
+    }
+
+    if (!openEpoll())
+      return false;
+    epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.fd = listen_fd;
+    return epoll_ctl(epoll_fd, EPOLL_CTL_ADD, listen_fd, &event) == 0;
+  }
+
+  // Creates the epoll instance on first use.
+  bool openEpoll() {
+    if (epoll_fd >= 0)
+      return true;
+    epoll_fd = epoll_create1(0);
+    if (epoll_fd < 0) {
+      perror("epoll_create1");
+      return false;
+    }
+    return true;
+  }
+
+  void acceptClients() {
+    while (true) {
+      int client_fd = accept(listen_fd, nullptr, nullptr);
+      if (client_fd < 0)
+        return;
+      addClient(client_fd);
+    }
+  }
+
+  // Reads one chunk, answers the complete lines in it, then sends the batch.
+  // Epoll reports any further input on the next round, so the other clients
+  // get a turn. Nothing is read while the client's unsent output is over
+  // kMaxPendingOutput. Returns false once the client has disconnected,
+  // failed, or sent a line longer than kMaxLineBytes.
+  bool readClient(int fd) {
+    ClientState &client = clients[fd];
+    char chunk[kReadChunk];
+    while (!client.peer_closed &&
+           client.output.size() <= kMaxPendingOutput) {
+      ssize_t length = read(fd, chunk, sizeof(chunk));
+      if (length > 0) {
+        client.input.append(chunk, length);
+        answerLines(client);
+        if (client.input.size() > kMaxLineBytes)
+          return false;
+        break;
+      }
+      if (length == 0)
+        client.peer_closed = true;
+      else if (errno == EINTR)
+        continue;
+      else if (errno != EAGAIN && errno != EWOULDBLOCK)
+        return false;
+      break;
+    }
+    return flushClient(fd);
+  }
+
+  // Executes every complete line buffered for 'client'.
+  void answerLines(ClientState &client) {
+    size_t line_begin = 0;
+    size_t line_end;
+    while ((line_end = client.input.find('\n', line_begin)) != string::npos) {
+      const char *begin = client.input.data() + line_begin;
+      const char *end = client.input.data() + line_end;
+      if (parseQueryLine(begin, end, query)) {
+        tree.execute(query, response);
+        ResponseFormatter::append(client.output, response);
+      } else {
+        client.output += kInvalidQueryMessage;
+        client.output += '\n';
+      }
+      line_begin = line_end + 1;
+    }
+    client.input.erase(0, line_begin);
+  }
+
+  // Writes as much buffered output as the socket accepts, asking epoll for
+  // EPOLLOUT while some remains. A half-closed client is no longer watched
+  // for input, since EOF would keep it readable, and neither is a client
+  // with more than kMaxPendingOutput bytes unsent. Returns false on a write
+  // error, or once a half-closed client has been sent everything.
+  bool flushClient(int fd) {
+    ClientState &client = clients[fd];
+    size_t written = 0;
+    while (written < client.output.size()) {
+      ssize_t length = write(fd, client.output.data() + written,
+                             client.output.size() - written);
+      if (length > 0) {
+        written += length;
+        continue;
+      }
+      if (length < 0 && errno == EINTR)
+        continue;
+      if (length < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        break;
+      return false;
+    }
+    client.output.erase(0, written);
+
+    if (client.peer_closed && client.output.empty())
+      return false;
+
+    const bool want_input =
+        !client.peer_closed && client.output.size() <= kMaxPendingOutput;
+    uint32_t want_events = want_input ? static_cast<uint32_t>(EPOLLIN) : 0u;
+    if (!client.output.empty())
+      want_events |= static_cast<uint32_t>(EPOLLOUT);
+    if (want_events != client.watched_events) {
+      epoll_event event;
+      memset(&event, 0, sizeof(event));
+      event.events = want_events;
+      event.data.fd = fd;
+      epoll_ctl(epoll_fd, EPOLL_CTL_MOD, fd, &event);
+      client.watched_events = want_events;
+    }
+    return true;
+  }
+
+  void closeClient(int fd) {
+    epoll_ctl(epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+    close(fd);
+    clients.erase(fd);
+  }
+
+  // The resident index shared by every client.
+  RedBlackTree &tree;
+
+  // Filesystem path of the listening socket.
+  string socket_path;
+
+  int listen_fd;
+  int epoll_fd;
+
+  // Connected clients keyed by file descriptor.
+  map<int, ClientState> clients;
+
+  // Scratch objects reused for every line.
+  Query query;
+  QueryResponse response;
+};
+
+constexpr int QueryServer::kMaxEvents;
+constexpr size_t QueryServer::kReadChunk;
+constexpr size_t QueryServer::kMaxLineBytes;
+constexpr size_t QueryServer::kMaxPendingOutput;
+
+#endif // INHA_ALGORITHM_003_QUERY_SERVER_HPP
@@ -0,0 +1,1022 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-07-03
+ *
+ * Description: Course registration index built on BasicRedBlackTree. Queries
+ * are executed into QueryResponse records so that parsing, execution and
+ * output formatting can run in separate stages (see query_io.hpp and
+ * query_pipeline.hpp). Two timestamp-ordered secondary indexes answer the
+ * global "K earliest registrants" query, and a per-subject index of every
+ * timestamp version answers "first K as of T" queries. An "F" query freezes
+ * the L/C/M answers into Eytzinger-ordered arrays for read-only phases; the
+ * next insert (or a "T" query) thaws back to the mutable maps. A MemoryLedger
+ * tracks the bytes of every component and an "S" query reports them.
+ */
+#ifndef INHA_ALGORITHM_003_RED_BLACK_TREE_HPP
+#define INHA_ALGORITHM_003_RED_BLACK_TREE_HPP
+
+#include "basic_red_black_tree.hpp"
+#include "eytzinger_index.hpp"
+#include "memory_ledger.hpp"
+#include <algorithm>
+#include <climits>
+#include <map>
+#include <queue>
+#include <string>
+#include <unordered_set>
+#include <vector>
+using namespace std;
+
+class RedBlackTree;
+
+// Payload stored in each registration node.
+struct StudentRecord {
+  // Student name.
+  string sname;
+
+  // Semester of course registration.
+  int semester;
+
+  // Student phone number.
+  string phone;
+
+  // Timestamp of registration (used for earliest applicant logic).
+  int timestamp;
+};
+
+// Composite key: (student ID, subject name) used for tree ordering.
+typedef pair<int, string> NodeKey;
+typedef BasicRedBlackTree<NodeKey, StudentRecord, NodeKeyComparator>
+    StudentTree;
+typedef StudentTree::Node Node;
+typedef pair<string, Node *> SubjectNodePair;
+
+// The maps and their vectors charge their blocks to the tree's MemoryLedger.
+typedef vector<SubjectNodePair, AccountingAllocator<SubjectNodePair>>
+    SubjectNodeVector;
+typedef vector<Node *, AccountingAllocator<Node *>> NodeVector;
+typedef map<int, SubjectNodeVector, less<int>,
+            AccountingAllocator<pair<const int, SubjectNodeVector>>>
+    SidMap;
+typedef map<string, NodeVector, less<string>,
+            AccountingAllocator<pair<const string, NodeVector>>>
+    SubjectMap;
+
+// Secondary-index key: one registration seen through its current timestamp.
+// 'subject' points at the subject stored in the registration node.
+struct TimestampKey {
+  const string *subject;
+  int timestamp;
+  int sid;
+};
+
+// Comparator policy: global order (timestamp, sid, subject).
+struct TimestampOrderComparator {
+  static int compare(const TimestampKey &a, const TimestampKey &b) {
+    if (a.timestamp != b.timestamp)
+      return (a.timestamp < b.timestamp) ? kCompareLess : kCompareGreater;
+    if (a.sid != b.sid)
+      return (a.sid < b.sid) ? kCompareLess : kCompareGreater;
+    const int result = a.subject->compare(*b.subject);
+    return (result > 0) - (result < 0);
+  }
+};
+
+// Comparator policy: per-subject order (subject, timestamp, sid).
+struct SubjectTimestampComparator {
+  static int compare(const TimestampKey &a, const TimestampKey &b) {
+    const int result = a.subject->compare(*b.subject);
+    if (result != 0)
+      return (result > 0) - (result < 0);
+    if (a.timestamp != b.timestamp)
+      return (a.timestamp < b.timestamp) ? kCompareLess : kCompareGreater;
+    return IntKeyComparator::compare(a.sid, b.sid);
+  }
+};
+
+// One timestamp version of a registration: valid from its key's timestamp
+// until 'superseded_at' (INT_MAX while it is the current version).
+struct TimestampVersion {
+  Node *node;
+  int superseded_at;
+};
+
+typedef BasicRedBlackTree<TimestampKey, Node *, TimestampOrderComparator>
+    TimestampIndex;
+typedef BasicRedBlackTree<TimestampKey, Node *, SubjectTimestampComparator>
+    SubjectTimestampIndex;
+typedef BasicRedBlackTree<TimestampKey, TimestampVersion,
+                          SubjectTimestampComparator>
+    SubjectVersionIndex;
+
+enum class QueryType : char {
+  kInsert = 'I',
+  kListSubjects = 'L',
+  kCountStudents = 'C',
+  kEarliestApplicants = 'M',
+  kGlobalEarliestApplicants = 'E',
+  kEarliestApplicantsAsOf = 'A',
+  kFreeze = 'F',
+  kThaw = 'T',
+  kMemoryReport = 'S'
+};
+
+// A parsed query line. Only the fields used by 'type' are meaningful.
+struct Query {
+  QueryType type;
+  int sid;
+  string subject;
+  string sname;
+  int semester;
+  string phone;
+  // Registration time for I; the "as of" time T for A.
+  int timestamp;
+  int k;
+};
+
+// Status of an executed query, selecting how its response is printed.
+enum class ResponseStatus : char {
+  kOk,
+  kNoRecordsFound,
+  kUnexpectedError
+};
+
+// One "<subject|sid> <color>" item of an L or M response, or one
+// "<sid> <subject> <color>" item of an E response. 'subject' points at the key
+// stored in the tree node, so it stays valid while the tree lives.
+struct ResponseEntry {
+  const string *subject;
+  int sid;
+  char color;
+};
+
+// Result of one query, captured at execution time (colors included) so that
+// it can be formatted later on another thread.
+struct QueryResponse {
+  QueryType type;
+  ResponseStatus status;
+
+  // I: (depth, duplicate status); C: (student count, depth sum);
+  // F, T: (registration count, unused).
+  int first_value;
+  int second_value;
+
+  // L: (subject, color) items; M, A: (sid, color) items;
+  // E: (sid, subject, color) items.
+  vector<ResponseEntry> entries;
+
+  // S: one item per MemoryComponent.
+  vector<MemoryUsage> memory_usage;
+};
+
+// Comparator policy: subject names reached through pointers.
+struct SubjectPointerComparator {
+  static int compare(const string *a, const string *b) {
+    const int result = a->compare(*b);
+    return (result > 0) - (result < 0);
+  }
+};
+
+// Frozen L answer of one student: entries [begin, end) of sid_entries.
+struct FrozenStudent {
+  int sid;
+  size_t begin;
+  size_t end;
+};
+
+// Frozen C and M answers of one subject: entries [begin, end) of
+// subject_entries are its registrations in M order. A subject whose
+// registrations share a timestamp stores no entries; its M keeps sorting the
+// mutable vector, since the order of the ties depends on every earlier sort.
+struct FrozenSubject {
+  const string *subject;
+  int student_count;
+  int depth_sum;
+  bool has_ties;
+  size_t begin;
+  size_t end;
+};
+
+// Read-only snapshot of the L/C/M answers. Each lookup is one branch-free
+// Eytzinger descent followed by a contiguous copy; depths and colors are
+// captured from the tree at freeze time, so the output is unchanged.
+struct FrozenLayout {
+  EytzingerIndex<int, IntKeyComparator> sid_index;
+  vector<FrozenStudent> students;
+  vector<ResponseEntry> sid_entries;
+
+  EytzingerIndex<const string *, SubjectPointerComparator> subject_index;
+  vector<FrozenSubject> subjects;
+  vector<ResponseEntry> subject_entries;
+
+  // Heap bytes of every array above.
+  size_t heapBytes() const {
+    return sid_index.heapBytes() + MemoryLedger::vectorHeapBytes(students) +
+           MemoryLedger::vectorHeapBytes(sid_entries) +
+           subject_index.heapBytes() +
+           MemoryLedger::vectorHeapBytes(subjects) +
+           MemoryLedger::vectorHeapBytes(subject_entries);
+  }
+
+  // Number of heap blocks behind the arrays above.
+  size_t heapBlocks() const {
+    return sid_index.heapBlocks() + (students.capacity() != 0) +
+           (sid_entries.capacity() != 0) + subject_index.heapBlocks() +
+           (subjects.capacity() != 0) + (subject_entries.capacity() != 0);
+  }
+};
+
+class RedBlackTree {
+public:
+  // Constructor: Initializes an empty Red-Black Tree. Nodes are carved from
+  // 'arena' when given (the arena must outlive the tree).
+  explicit RedBlackTree(NodeArena *arena = nullptr);
+
+  // Executes any parsed query and stores its result in 'response'.
+  void execute(const Query &query, QueryResponse &response);
+
+  // Executes 'count' queries in order into 'responses'. Within a run of
+  // queries that leave the tree unchanged, the L lookups are resolved with
+  // one batched descent (StudentTree::lowerBoundBatch).
+  void executeBatch(const Query *queries, size_t count,
+                    QueryResponse *responses);
+
+  // Whether 'type' may change the tree (and so ends a read-only run).
+  static bool isMutating(QueryType type);
+
+  // Query Type: “I sid subject sname semester phone timestamp”
+  void inquireInsert(const int &sid, const string &subject, const string &sname,
+                     const int &semester, const string &phone,
+                     const int &timestamp, QueryResponse &response);
+
+  // Query Type: “L sid”
+  void inquireAllSubjects(const int &sid, QueryResponse &response);
+
+  // Query Type: "C subject”
+  void inquireStudentNumberOfSubject(const string &subject,
+                                     QueryResponse &response);
+
+  // Query Type: ”M subject K”
+  void inquireEarlyStudent(const string &subject, const int &k,
+                           QueryResponse &response);
+
+  // Query Type: "E prefix K": the K earliest registrations over every subject
+  // starting with 'prefix' ("*" matches all subjects).
+  void inquireGlobalEarlyStudents(const string &prefix, const int &k,
+                                  QueryResponse &response);
+
+  // Query Type: "A subject K T": the K earliest registrations for 'subject' as
+  // they stood at time T, i.e. using each student's timestamp version that
+  // was current at T. The walk also passes the subject's versions up to T
+  // that were superseded by T, so it costs O(log n + K + S) for S of those.
+  void inquireEarlyStudentAsOf(const string &subject, const int &k,
+                               const int &as_of, QueryResponse &response);
+
+  // Query Type: "F": lays the L/C/M answers out for a read-only phase.
+  void inquireFreeze(QueryResponse &response);
+
+  // Query Type: "T": drops the frozen layout and returns to the mutable maps.
+  void inquireThaw(QueryResponse &response);
+
+  // Query Type: "S": bytes and allocations of every memory component.
+  void inquireMemoryUsage(QueryResponse &response) const;
+
+  // Selects the insertion strategy of the registration tree and of every
+  // secondary index. Call before the first insert: depths and colors in the
+  // output follow the strategy.
+  void setInsertMode(InsertMode mode);
+
+  // Whether L/C/M queries are currently answered from the frozen layout.
+  bool isFrozen() const { return is_frozen; }
+
+  // Prefix of an E query that matches every subject.
+  static constexpr const char *kAnySubjectPrefix = "*";
+
+  // Message: Should never happen if logic is correct (guard message).
+  static constexpr const char *kUnexpectedErrorMessage =
+      "Algorithm error! You must solve this problem.";
+
+  // Message: Displayed when no records are found for a query.
+  static constexpr const char *kNoRecordsFoundMessage = "No records found";
+
+private:
+  // Comparator: returns true if the subject name of 'a' is lexicographically
+  // less than 'b'.
+  static bool subjectNameLess(const SubjectNodePair &a,
+                              const SubjectNodePair &b);
+
+  // Comparator: returns true if 'a' has an earlier timestamp than 'b'.
+  static bool timestampLess(Node *&a, Node *&b);
+
+  // Stores the depth of the node and whether it was a duplicate.
+  void setNodeStatus(Node *node, const bool &status, QueryResponse &response);
+
+  // Handles case where the node already exists (updates timestamp).
+  void handleDuplicateNode(Node *existing_node, const int &new_timestamp,
+                           QueryResponse &response);
+
+  // Inserts a node into both sid_map and subject_map.
+  void insertToMaps(const int &sid, const string &subject, Node *new_node);
+
+  // Adds subject info to sid_map for a given student ID.
+  void insertStudentToSidMap(const int &sid, const string &subject,
+                             Node *new_node);
+
+  // Adds student node to subject_map for the given subject.
+  void insertStudentToSubjectMap(const string &subject, Node *new_node);
+
+  // Adds the node's current timestamp to both timestamp indexes.
+  void insertToTimestampIndexes(Node *node);
+
+  // Removes the node's current timestamp from both timestamp indexes.
+  void eraseFromTimestampIndexes(Node *node);
+
+  // Closes the node's current version at 'new_timestamp' and opens a new one.
+  void appendTimestampVersion(Node *node, const int &new_timestamp);
+
+  // Returns the secondary-index key of the node's current timestamp.
+  static TimestampKey makeTimestampKey(Node *node);
+
+  // Charges the heap block of 's' (if any) to 'component'.
+  void chargeString(MemoryComponent component, const string &s);
+
+  // Charges a newly inserted registration: its nodes and strings.
+  void chargeRegistration(Node *node);
+
+  // Answers the L queries among queries[begin, end) (a read-only run) from
+  // batched student_tree descents; other queries are executed one by one.
+  void executeReadRun(const Query *queries, size_t begin, size_t end,
+                      QueryResponse *responses);
+
+  // Rebuilds frozen_layout from sid_map and subject_map.
+  void buildFrozenLayout();
+
+  // Leaves the frozen state and frees frozen_layout.
+  void releaseFrozenLayout();
+
+  // Frozen-layout versions of the L, C and M queries.
+  void inquireFrozenAllSubjects(const int &sid, QueryResponse &response) const;
+  void inquireFrozenStudentNumberOfSubject(const string &subject,
+                                           QueryResponse &response) const;
+  void inquireFrozenEarlyStudent(const FrozenSubject &frozen_subject,
+                                 const int &k, QueryResponse &response) const;
+
+  // Returns the frozen subject named 'subject', or nullptr.
+  const FrozenSubject *findFrozenSubject(const string &subject) const;
+
+  // Balanced (sid, subject) tree holding every registration record.
+  StudentTree student_tree;
+
+  // Every registration ordered by (timestamp, sid, subject).
+  TimestampIndex timestamp_index;
+
+  // Every registration ordered by (subject, timestamp, sid).
+  SubjectTimestampIndex subject_timestamp_index;
+
+  // Every timestamp version ever applied, ordered by (subject, timestamp,
+  // sid). Versions are never erased.
+  SubjectVersionIndex subject_version_index;
+
+  // Bytes and allocations per component; declared before the maps whose
+  // allocators point into it.
+  MemoryLedger memory_ledger;
+
+  // Mapping from student ID to a list of (subject, node*) entries.
+  SidMap sid_map;
+
+  // Mapping from subject name to a list of student nodes.
+  SubjectMap subject_map;
+
+  // Snapshot used by L/C/M while 'is_frozen' is set.
+  FrozenLayout frozen_layout;
+  bool is_frozen;
+};
+
+inline RedBlackTree::RedBlackTree(NodeArena *arena)
+    : student_tree(arena), timestamp_index(arena),
+      subject_timestamp_index(arena), subject_version_index(arena),
+      sid_map(less<int>(), SidMap::allocator_type(&memory_ledger.counter(
+                               MemoryComponent::kMapNodes))),
+      subject_map(less<string>(),
+                  SubjectMap::allocator_type(
+                      &memory_ledger.counter(MemoryComponent::kMapNodes))),
+      is_frozen(false) {}
+
+constexpr const char *RedBlackTree::kAnySubjectPrefix;
+constexpr const char *RedBlackTree::kUnexpectedErrorMessage;
+constexpr const char *RedBlackTree::kNoRecordsFoundMessage;
+
+// Executes any parsed query and stores its result in 'response'.
+inline void RedBlackTree::execute(const Query &query, QueryResponse &response) {
+  response.type = query.type;
+  response.status = ResponseStatus::kOk;
+  response.entries.clear();
+  response.memory_usage.clear();
+
+  switch (query.type) {
+  case QueryType::kInsert:
+    inquireInsert(query.sid, query.subject, query.sname, query.semester,
+                  query.phone, query.timestamp, response);
+    break;
+  case QueryType::kListSubjects:
+    inquireAllSubjects(query.sid, response);
+    break;
+  case QueryType::kCountStudents:
+    inquireStudentNumberOfSubject(query.subject, response);
+    break;
+  case QueryType::kEarliestApplicants:
+    inquireEarlyStudent(query.subject, query.k, response);
+    break;
+  case QueryType::kGlobalEarliestApplicants:
+    inquireGlobalEarlyStudents(query.subject, query.k, response);
+    break;
+  case QueryType::kEarliestApplicantsAsOf:
+    inquireEarlyStudentAsOf(query.subject, query.k, query.timestamp, response);
+    break;
+  case QueryType::kFreeze:
+    inquireFreeze(response);
+    break;
+  case QueryType::kThaw:
+    inquireThaw(response);
+    break;
+  case QueryType::kMemoryReport:
+    inquireMemoryUsage(response);
+    break;
+  }
+}
+
+// Executes 'count' queries in order into 'responses'.
+inline void RedBlackTree::executeBatch(const Query *queries, size_t count,
+                                       QueryResponse *responses) {
+  size_t run_begin = 0;
+  for (size_t i = 0; i <= count; i++) {
+    if (i < count && !isMutating(queries[i].type))
+      continue;
+    executeReadRun(queries, run_begin, i, responses);
+    if (i < count)
+      execute(queries[i], responses[i]);
+    run_begin = i + 1;
+  }
+}
+
+// Whether 'type' may change the tree (and so ends a read-only run).
+inline bool RedBlackTree::isMutating(QueryType type) {
+  return type == QueryType::kInsert || type == QueryType::kFreeze ||
+         type == QueryType::kThaw;
+}
+
+// Answers the L queries of a read-only run from batched descents.
+inline void RedBlackTree::executeReadRun(const Query *queries, size_t begin,
+                                         size_t end,
+                                         QueryResponse *responses) {
+  vector<NodeKey> list_keys;
+  vector<size_t> list_queries;
+  for (size_t i = begin; i < end; i++) {
+    if (queries[i].type == QueryType::kListSubjects && !is_frozen) {
+      list_keys.push_back(NodeKey(queries[i].sid, string()));
+      list_queries.push_back(i);
+    } else {
+      execute(queries[i], responses[i]);
+    }
+  }
+  if (list_keys.empty())
+    return;
+
+  // The student's nodes are contiguous in (sid, subject) order, so the walk
+  // from the first one lists its subjects in dictionary order, as L does.
+  vector<Node *> first_nodes(list_keys.size());
+  student_tree.lowerBoundBatch(list_keys.data(), list_keys.size(),
+                               first_nodes.data());
+  for (size_t j = 0; j < list_queries.size(); j++) {
+    QueryResponse &response = responses[list_queries[j]];
+    const int sid = list_keys[j].first;
+    response.type = QueryType::kListSubjects;
+    response.status = ResponseStatus::kOk;
+    response.entries.clear();
+    for (Node *node = first_nodes[j];
+         node != nullptr && node->getKey().first == sid;
+         node = StudentTree::successor(node)) {
+      response.entries.push_back(
+          ResponseEntry{&node->getKey().second, 0, node->getColor()});
+    }
+    if (response.entries.empty())
+      response.status = ResponseStatus::kNoRecordsFound;
+  }
+}
+
+// Query Type: “I sid subject sname semester phone timestamp”
+inline void RedBlackTree::inquireInsert(const int &sid, const string &subject,
+                                        const string &sname,
+                                        const int &semester,
+                                        const string &phone,
+                                        const int &timestamp,
+                                        QueryResponse &response) {
+  // Any insert may rotate nodes, so the frozen depths and colors go stale.
+  if (is_frozen)
+    releaseFrozenLayout();
+
+  // Insert the record, or find the node that already holds its key.
+  StudentTree::InsertResult inserted_result = student_tree.insert(
+      NodeKey(sid, subject),
+      StudentRecord{sname, semester, phone, timestamp});
+  Node *node = inserted_result.first;
+
+  // If that key already exists in the tree, only timestamp is updated.
+  if (inserted_result.second == StudentTree::kIsDuplicateNode) {
+    handleDuplicateNode(node, timestamp, response);
+    return;
+  }
+
+  insertToMaps(sid, subject, node);
+  insertToTimestampIndexes(node);
+  subject_version_index.insert(makeTimestampKey(node),
+                               TimestampVersion{node, INT_MAX});
+  chargeRegistration(node);
+  setNodeStatus(node, StudentTree::kIsNewlyInserted, response);
+}
+
+// Query Type: “L sid”
+inline void RedBlackTree::inquireAllSubjects(const int &sid,
+                                             QueryResponse &response) {
+  if (is_frozen) {
+    inquireFrozenAllSubjects(sid, response);
+    return;
+  }
+
+  // Retrieve all subjects a student has applied for.
+  SidMap::iterator sid_iter = sid_map.find(sid);
+  if (sid_iter != sid_map.end()) {
+    // Save the entire application for a particular student.
+    SubjectNodeVector &sid_vector = sid_iter->second;
+
+    // Sort in dictionary order.
+    sort(sid_vector.begin(), sid_vector.end(), subjectNameLess);
+
+    // Collect the node's subject and the node's color.
+    for (const SubjectNodePair &ele : sid_vector) {
+      response.entries.push_back(
+          ResponseEntry{&ele.second->getKey().second, 0,
+                        ele.second->getColor()});
+    }
+    return;
+  }
+
+  response.status = ResponseStatus::kNoRecordsFound;
+}
+
+// Query Type: "C subject”
+inline void
+RedBlackTree::inquireStudentNumberOfSubject(const string &subject,
+                                            QueryResponse &response) {
+  if (is_frozen) {
+    inquireFrozenStudentNumberOfSubject(subject, response);
+    return;
+  }
+
+  // Look up the number of students who applied for a particular subject.
+  SubjectMap::iterator subject_iter = subject_map.find(subject);
+  if (subject_iter != subject_map.end()) {
+    // Save the number of students who applied for the given subject.
+    const NodeVector &subject_vector = subject_iter->second;
+
+    // Add depth as it traverses the node.
+    int depth_sum = 0;
+    for (Node *ele : subject_vector) {
+      depth_sum += StudentTree::getNodeDepth(ele);
+    }
+
+    // The number of students who applied for the subject and the sum of the
+    // depths of the nodes holding their applications.
+    response.first_value = subject_vector.size();
+    response.second_value = depth_sum;
+    return;
+  }
+
+  // This should not happen if the algorithm and input are correct.
+  response.status = ResponseStatus::kUnexpectedError;
+}
+
+// Query Type: ”M subject K”
+inline void RedBlackTree::inquireEarlyStudent(const string &subject,
+                                              const int &k,
+                                              QueryResponse &response) {
+  if (is_frozen) {
+    const FrozenSubject *frozen_subject = findFrozenSubject(subject);
+    if (frozen_subject == nullptr) {
+      // This should not happen if the algorithm and input are correct.
+      response.status = ResponseStatus::kUnexpectedError;
+      return;
+    }
+    if (!frozen_subject->has_ties) {
+      inquireFrozenEarlyStudent(*frozen_subject, k, response);
+      return;
+    }
+  }
+
+  // Retrieve up to K students who applied earliest for the subject.
+  SubjectMap::iterator subject_iter = subject_map.find(subject);
+  if (subject_iter != subject_map.end()) {
+    // Save the K number of students who applied for a particular subject first.
+    NodeVector &subject_vector = subject_iter->second;
+
+    // Sort the student nodes by earliest timestamp (ascending).
+    sort(subject_vector.begin(), subject_vector.end(), timestampLess);
+
+    // Determine how many students to report (up to K).
+    const int subject_vector_size = subject_vector.size();
+    int range_max = (subject_vector_size < k) ? subject_vector_size : k;
+
+    // Among the application records in which 'subject' matches, 'timestamp' is
+    // the fastest, and 'K' nodes are collected.
+    for (int i = 0; i < range_max; i++) {
+      Node *subject_node = subject_vector[i];
+      response.entries.push_back(ResponseEntry{
+          nullptr, subject_node->getKey().first, subject_node->getColor()});
+    }
+    return;
+  }
+
+  // This should not happen if the algorithm and input are correct.
+  response.status = ResponseStatus::kUnexpectedError;
+}
+
+// Query Type: "E prefix K"
+inline void RedBlackTree::inquireGlobalEarlyStudents(const string &prefix,
+                                                     const int &k,
+                                                     QueryResponse &response) {
+  if (prefix == kAnySubjectPrefix) {
+    // Unfiltered: walk the global index from its first node, O(K + log n).
+    TimestampIndex::Node *index_node = timestamp_index.first();
+    if (index_node == nullptr) {
+      response.status = ResponseStatus::kNoRecordsFound;
+      return;
+    }
+    for (int i = 0; i < k && index_node != nullptr; i++) {
+      Node *node = index_node->getValue();
+      response.entries.push_back(ResponseEntry{
+          &node->getKey().second, node->getKey().first, node->getColor()});
+      index_node = TimestampIndex::successor(index_node);
+    }
+    return;
+  }
+
+  // Filtered: the matching subjects are one contiguous range of subject_map.
+  // Merge their per-subject runs by timestamp: O(S log n + K log S).
+  typedef SubjectTimestampIndex::Node IndexNode;
+  auto laterFirst = [](IndexNode *a, IndexNode *b) {
+    return TimestampOrderComparator::compare(a->getKey(), b->getKey()) > 0;
+  };
+  priority_queue<IndexNode *, vector<IndexNode *>, decltype(laterFirst)>
+      run_heads(laterFirst);
+  for (SubjectMap::iterator it = subject_map.lower_bound(prefix);
+       it != subject_map.end() &&
+       it->first.compare(0, prefix.size(), prefix) == 0;
+       ++it) {
+    IndexNode *run_head = subject_timestamp_index.lowerBound(
+        TimestampKey{&it->first, INT_MIN, INT_MIN});
+    if (run_head != nullptr && *run_head->getKey().subject == it->first)
+      run_heads.push(run_head);
+  }
+  if (run_heads.empty()) {
+    response.status = ResponseStatus::kNoRecordsFound;
+    return;
+  }
+
+  while (static_cast<int>(response.entries.size()) < k && !run_heads.empty()) {
+    IndexNode *run_head = run_heads.top();
+    run_heads.pop();
+    Node *node = run_head->getValue();
+    response.entries.push_back(ResponseEntry{
+        &node->getKey().second, node->getKey().first, node->getColor()});
+
+    IndexNode *next_node = SubjectTimestampIndex::successor(run_head);
+    if (next_node != nullptr &&
+        *next_node->getKey().subject == *run_head->getKey().subject)
+      run_heads.push(next_node);
+  }
+}
+
+// Query Type: "A subject K T"
+inline void RedBlackTree::inquireEarlyStudentAsOf(const string &subject,
+                                                  const int &k,
+                                                  const int &as_of,
+                                                  QueryResponse &response) {
+  if (subject_map.find(subject) == subject_map.end()) {
+    // This should not happen if the algorithm and input are correct.
+    response.status = ResponseStatus::kUnexpectedError;
+    return;
+  }
+
+  // Walk the subject's versions in timestamp order up to T. A version counts
+  // if it was still current at T; versions superseded by then are skipped.
+  // A re-registration back to an earlier timestamp can leave two versions of
+  // one student current at T; only the earlier one is listed.
+  unordered_set<int> listed_sids;
+  SubjectVersionIndex::Node *version_node = subject_version_index.lowerBound(
+      TimestampKey{&subject, INT_MIN, INT_MIN});
+  while (version_node != nullptr &&
+         static_cast<int>(response.entries.size()) < k) {
+    const TimestampKey &version_key = version_node->getKey();
+    if (*version_key.subject != subject || version_key.timestamp > as_of)
+      break;
+    const TimestampVersion &version = version_node->getValue();
+    if (version.superseded_at > as_of &&
+        listed_sids.insert(version_key.sid).second) {
+      response.entries.push_back(
+          ResponseEntry{nullptr, version_key.sid, version.node->getColor()});
+    }
+    version_node = SubjectVersionIndex::successor(version_node);
+  }
+}
+
+// Query Type: "F"
+inline void RedBlackTree::inquireFreeze(QueryResponse &response) {
+  buildFrozenLayout();
+  is_frozen = true;
+  response.first_value = student_tree.size();
+  response.second_value = 0;
+}
+
+// Query Type: "T"
+inline void RedBlackTree::inquireThaw(QueryResponse &response) {
+  releaseFrozenLayout();
+  response.first_value = student_tree.size();
+  response.second_value = 0;
+}
+
+// Selects the insertion strategy of every tree in the index.
+inline void RedBlackTree::setInsertMode(InsertMode mode) {
+  student_tree.setInsertMode(mode);
+  timestamp_index.setInsertMode(mode);
+  subject_timestamp_index.setInsertMode(mode);
+  subject_version_index.setInsertMode(mode);
+}
+
+// Query Type: "S"
+inline void RedBlackTree::inquireMemoryUsage(QueryResponse &response) const {
+  memory_ledger.report(response.memory_usage);
+}
+
+// Rebuilds frozen_layout from sid_map and subject_map.
+inline void RedBlackTree::buildFrozenLayout() {
+  FrozenLayout &layout = frozen_layout;
+  layout.students.clear();
+  layout.sid_entries.clear();
+  layout.subjects.clear();
+  layout.subject_entries.clear();
+  layout.sid_entries.reserve(student_tree.size());
+  layout.subject_entries.reserve(student_tree.size());
+
+  // L answers: sid_map is already in sid order; subjects use the L sort.
+  vector<int> sorted_sids;
+  sorted_sids.reserve(sid_map.size());
+  for (SidMap::value_type &sid_pair : sid_map) {
+    SubjectNodeVector &sid_vector = sid_pair.second;
+    sort(sid_vector.begin(), sid_vector.end(), subjectNameLess);
+    const size_t begin = layout.sid_entries.size();
+    for (const SubjectNodePair &ele : sid_vector) {
+      layout.sid_entries.push_back(ResponseEntry{
+          &ele.second->getKey().second, 0, ele.second->getColor()});
+    }
+    layout.students.push_back(
+        FrozenStudent{sid_pair.first, begin, layout.sid_entries.size()});
+    sorted_sids.push_back(sid_pair.first);
+  }
+  layout.sid_index.build(sorted_sids);
+
+  // C and M answers: subject_map is in subject order; entries use the M sort.
+  // The sort runs on a copy, so the mutable vectors keep the order an
+  // unfrozen run would leave them in.
+  vector<const string *> sorted_subjects;
+  sorted_subjects.reserve(subject_map.size());
+  vector<Node *> m_order;
+  for (SubjectMap::value_type &subject_pair : subject_map) {
+    const NodeVector &subject_vector = subject_pair.second;
+    m_order.assign(subject_vector.begin(), subject_vector.end());
+    sort(m_order.begin(), m_order.end(), timestampLess);
+    bool has_ties = false;
+    int depth_sum = 0;
+    for (size_t i = 0; i < m_order.size(); i++) {
+      depth_sum += StudentTree::getNodeDepth(m_order[i]);
+      if (i > 0 && !timestampLess(m_order[i - 1], m_order[i]))
+        has_ties = true;
+    }
+    const size_t begin = layout.subject_entries.size();
+    if (!has_ties) {
+      for (Node *ele : m_order) {
+        layout.subject_entries.push_back(
+            ResponseEntry{nullptr, ele->getKey().first, ele->getColor()});
+      }
+    }
+    layout.subjects.push_back(FrozenSubject{
+        &subject_pair.first, static_cast<int>(subject_vector.size()),
+        depth_sum, has_ties, begin, layout.subject_entries.size()});
+    sorted_subjects.push_back(&subject_pair.first);
+  }
+  layout.subject_index.build(sorted_subjects);
+
+  MemoryCounter &frozen_counter =
+      memory_ledger.counter(MemoryComponent::kFrozenLayout);
+  frozen_counter.bytes = layout.heapBytes();
+  frozen_counter.objects = layout.heapBlocks();
+}
+
+// Leaves the frozen state and frees frozen_layout.
+inline void RedBlackTree::releaseFrozenLayout() {
+  is_frozen = false;
+  frozen_layout = FrozenLayout();
+  memory_ledger.counter(MemoryComponent::kFrozenLayout) = MemoryCounter();
+}
+
+// Frozen "L sid"
+inline void RedBlackTree::inquireFrozenAllSubjects(
+    const int &sid, QueryResponse &response) const {
+  const size_t rank = frozen_layout.sid_index.lowerBound(sid);
+  if (rank < frozen_layout.students.size() &&
+      frozen_layout.students[rank].sid == sid) {
+    const FrozenStudent &student = frozen_layout.students[rank];
+    response.entries.assign(frozen_layout.sid_entries.begin() + student.begin,
+                            frozen_layout.sid_entries.begin() + student.end);
+    return;
+  }
+
+  response.status = ResponseStatus::kNoRecordsFound;
+}
+
+// Frozen "C subject"
+inline void RedBlackTree::inquireFrozenStudentNumberOfSubject(
+    const string &subject, QueryResponse &response) const {
+  const FrozenSubject *frozen_subject = findFrozenSubject(subject);
+  if (frozen_subject != nullptr) {
+    response.first_value = frozen_subject->student_count;
+    response.second_value = frozen_subject->depth_sum;
+    return;
+  }
+
+  // This should not happen if the algorithm and input are correct.
+  response.status = ResponseStatus::kUnexpectedError;
+}
+
+// Frozen "M subject K"
+inline void RedBlackTree::inquireFrozenEarlyStudent(
+    const FrozenSubject &frozen_subject, const int &k,
+    QueryResponse &response) const {
+  const size_t subject_size = frozen_subject.end - frozen_subject.begin;
+  const size_t range_max =
+      (k < 0) ? 0 : min(subject_size, static_cast<size_t>(k));
+  response.entries.assign(
+      frozen_layout.subject_entries.begin() + frozen_subject.begin,
+      frozen_layout.subject_entries.begin() + frozen_subject.begin +
+          range_max);
+}
+
+// Returns the frozen subject named 'subject', or nullptr.
+inline const FrozenSubject *
+RedBlackTree::findFrozenSubject(const string &subject) const {
+  const size_t rank = frozen_layout.subject_index.lowerBound(&subject);
+  if (rank < frozen_layout.subjects.size() &&
+      *frozen_layout.subjects[rank].subject == subject)
+    return &frozen_layout.subjects[rank];
+  return nullptr;
+}
+
+// Comparator: returns true if the subject name of 'a' is lexicographically less
+// than 'b'.
+inline bool RedBlackTree::subjectNameLess(const SubjectNodePair &a,
+                                          const SubjectNodePair &b) {
+  return a.first < b.first;
+}
+
+// Comparator: returns true if 'a' has an earlier timestamp than 'b'.
+inline bool RedBlackTree::timestampLess(Node *&a, Node *&b) {
+  return a->getValue().timestamp < b->getValue().timestamp;
+}
+
+// Stores the depth of the node and whether it was a duplicate.
+inline void RedBlackTree::setNodeStatus(Node *node, const bool &status,
+                                        QueryResponse &response) {
+  response.first_value = StudentTree::getNodeDepth(node);
+  response.second_value = status;
+}
+
+// Handles case where the node already exists (updates timestamp).
+inline void RedBlackTree::handleDuplicateNode(Node *existing_node,
+                                              const int &new_timestamp,
+                                              QueryResponse &response) {
+  // Re-key the timestamp indexes around the update.
+  eraseFromTimestampIndexes(existing_node);
+  appendTimestampVersion(existing_node, new_timestamp);
+  insertToTimestampIndexes(existing_node);
+  setNodeStatus(existing_node, StudentTree::kIsDuplicateNode, response);
+}
+
+// Inserts a node into both sid_map and subject_map.
+inline void RedBlackTree::insertToMaps(const int &sid, const string &subject,
+                                       Node *new_node) {
+  insertStudentToSidMap(sid, subject, new_node);
+  insertStudentToSubjectMap(subject, new_node);
+}
+
+// Adds subject info to sid_map for a given student ID.
+inline void RedBlackTree::insertStudentToSidMap(const int &sid,
+                                                const string &subject,
+                                                Node *new_node) {
+  // The student's list is created (with the ledger's allocator) on first
+  // application.
+  SidMap::iterator sid_iter = sid_map.find(sid);
+  if (sid_iter == sid_map.end()) {
+    sid_iter =
+        sid_map
+            .emplace(sid,
+                     SubjectNodeVector(SubjectNodeVector::allocator_type(
+                         &memory_ledger.counter(
+                             MemoryComponent::kIndexVectors))))
+            .first;
+  }
+  sid_iter->second.push_back(SubjectNodePair(subject, new_node));
+  chargeString(MemoryComponent::kKeyStrings, sid_iter->second.back().first);
+}
+
+// Adds student node to subject_map for the given subject.
+inline void RedBlackTree::insertStudentToSubjectMap(const string &subject,
+                                                    Node *new_node) {
+  // Only newly inserted nodes reach here, so the node cannot already be
+  // listed; the subject's list is created on first application.
+  SubjectMap::iterator subject_iter = subject_map.find(subject);
+  if (subject_iter == subject_map.end()) {
+    subject_iter =
+        subject_map
+            .emplace(subject, NodeVector(NodeVector::allocator_type(
+                                  &memory_ledger.counter(
+                                      MemoryComponent::kIndexVectors))))
+            .first;
+    chargeString(MemoryComponent::kKeyStrings, subject_iter->first);
+  }
+  subject_iter->second.push_back(new_node);
+}
+
+// Returns the secondary-index key of the node's current timestamp.
+inline TimestampKey RedBlackTree::makeTimestampKey(Node *node) {
+  return TimestampKey{&node->getKey().second, node->getValue().timestamp,
+                      node->getKey().first};
+}
+
+// Charges the heap block of 's' (if any) to 'component'.
+inline void RedBlackTree::chargeString(MemoryComponent component,
+                                       const string &s) {
+  const size_t bytes = MemoryLedger::stringHeapBytes(s);
+  if (bytes != 0)
+    memory_ledger.add(component, bytes);
+}
+
+// Charges a newly inserted registration: its nodes and strings.
+inline void RedBlackTree::chargeRegistration(Node *node) {
+  memory_ledger.add(MemoryComponent::kTreeNodes, sizeof(StudentTree::Node));
+  memory_ledger.add(MemoryComponent::kIndexNodes,
+                    sizeof(TimestampIndex::Node) +
+                        sizeof(SubjectTimestampIndex::Node),
+                    2);
+  memory_ledger.add(MemoryComponent::kVersionNodes,
+                    sizeof(SubjectVersionIndex::Node));
+  chargeString(MemoryComponent::kKeyStrings, node->getKey().second);
+  chargeString(MemoryComponent::kPayloadStrings, node->getValue().sname);
+  chargeString(MemoryComponent::kPayloadStrings, node->getValue().phone);
+}
+
+// Adds the node's current timestamp to both timestamp indexes.
+inline void RedBlackTree::insertToTimestampIndexes(Node *node) {
+  const TimestampKey key = makeTimestampKey(node);
+  timestamp_index.insert(key, node);
+  subject_timestamp_index.insert(key, node);
+}
+
+// Removes the node's current timestamp from both timestamp indexes.
+inline void RedBlackTree::eraseFromTimestampIndexes(Node *node) {
+  const TimestampKey key = makeTimestampKey(node);
+  timestamp_index.erase(timestamp_index.find(key));
+  subject_timestamp_index.erase(subject_timestamp_index.find(key));
+}
+
+// Closes the node's current version at 'new_timestamp' and opens a new one.
+inline void RedBlackTree::appendTimestampVersion(Node *node,
+                                                 const int &new_timestamp) {
+  subject_version_index.find(makeTimestampKey(node))->getValue().superseded_at =
+      new_timestamp;
+  node->getValue().timestamp = new_timestamp;
+
+  // Re-registering with an earlier version's timestamp revives that entry.
+  SubjectVersionIndex::InsertResult inserted_result =
+      subject_version_index.insert(makeTimestampKey(node),
+                                   TimestampVersion{node, INT_MAX});
+  inserted_result.first->getValue().superseded_at = INT_MAX;
+  if (inserted_result.second == SubjectVersionIndex::kIsNewlyInserted)
+    memory_ledger.add(MemoryComponent::kVersionNodes,
+                      sizeof(SubjectVersionIndex::Node));
+}
+
+#endif // INHA_ALGORITHM_003_RED_BLACK_TREE_HPP
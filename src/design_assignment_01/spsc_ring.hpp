@@ -0,0 +1,71 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-06-09
+ *
+ * Description: Bounded lock-free single-producer/single-consumer ring used to
+ * hand query and response batches between pipeline stages.
+ */
+#ifndef INHA_ALGORITHM_003_SPSC_RING_HPP
+#define INHA_ALGORITHM_003_SPSC_RING_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include <vector>
+using namespace std;
+
+template <typename T> class SpscRing {
+public:
+  // Constructor: 'capacity' is rounded up to a power of two.
+  explicit SpscRing(size_t capacity) : head(0), tail(0) {
+    size_t rounded = 1;
+    while (rounded < capacity)
+      rounded <<= 1;
+    slots.resize(rounded);
+    mask = rounded - 1;
+  }
+
+  SpscRing(const SpscRing &) = delete;
+  SpscRing &operator=(const SpscRing &) = delete;
+
+  // Producer side: moves 'item' into the ring, spinning while it is full.
+  void push(T &&item) {
+    const size_t cur_tail = tail.load(memory_order_relaxed);
+    while (cur_tail - head.load(memory_order_acquire) > mask) {
+      this_thread::yield();
+    }
+    slots[cur_tail & mask] = move(item);
+    tail.store(cur_tail + 1, memory_order_release);
+  }
+
+  // Consumer side: moves the oldest item into 'item', spinning while empty.
+  void pop(T &item) {
+    const size_t cur_head = head.load(memory_order_relaxed);
+    while (tail.load(memory_order_acquire) == cur_head) {
+      this_thread::yield();
+    }
+    item = move(slots[cur_head & mask]);
+    head.store(cur_head + 1, memory_order_release);
+  }
+
+private:
+  // Storage for the ring; its size is always a power of two.
+  vector<T> slots;
+
+  // Index mask (capacity - 1).
+  size_t mask;
+
+  // Next slot to pop (written by the consumer only).
+  alignas(64) atomic<size_t> head;
+
+  // Next slot to push (written by the producer only).
+  alignas(64) atomic<size_t> tail;
+};
+
+#endif // INHA_ALGORITHM_003_SPSC_RING_HPP
@@ -0,0 +1,173 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-07-03
+ *
+ * Description: Fixed-size thread pool with one task deque per worker. A worker
+ * pops from the front of its own deque and, once it runs dry, steals from the
+ * back of the others, so long and short jobs even out across cores. Idle
+ * workers sleep on a condition variable until a task is queued. A task that
+ * throws still counts as finished; wait() rethrows the first exception.
+ */
+#ifndef INHA_ALGORITHM_003_WORK_STEALING_POOL_HPP
+#define INHA_ALGORITHM_003_WORK_STEALING_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+using namespace std;
+
+class WorkStealingPool {
+public:
+  // A task receives the index of the worker running it (0 .. size()-1), so it
+  // can use per-worker state such as an arena.
+  typedef function<void(int)> Task;
+
+  explicit WorkStealingPool(int worker_count)
+      : pending_count(0), queued_count(0), next_queue(0), stopping(false) {
+    if (worker_count < 1)
+      worker_count = 1;
+    for (int i = 0; i < worker_count; i++)
+      queues.emplace_back(new WorkerQueue());
+    for (int i = 0; i < worker_count; i++)
+      workers.emplace_back(&WorkStealingPool::workerLoop, this, i);
+  }
+
+  ~WorkStealingPool() {
+    {
+      lock_guard<mutex> lock(state_mutex);
+      stopping = true;
+    }
+    state_changed.notify_all();
+    for (thread &worker : workers)
+      worker.join();
+  }
+
+  WorkStealingPool(const WorkStealingPool &) = delete;
+  WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+
+  // Number of worker threads.
+  int size() const { return static_cast<int>(workers.size()); }
+
+  // Queues 'task' on the next worker in round-robin order.
+  void submit(Task task) {
+    WorkerQueue &queue = *queues[next_queue++ % queues.size()];
+    {
+      lock_guard<mutex> lock(queue.queue_mutex);
+      queue.tasks.push_back(move(task));
+    }
+    {
+      lock_guard<mutex> lock(state_mutex);
+      pending_count++;
+      queued_count++;
+    }
+    state_changed.notify_all();
+  }
+
+  // Blocks until every submitted task has finished. If a task threw, the
+  // first exception is rethrown here, once.
+  void wait() {
+    unique_lock<mutex> lock(state_mutex);
+    state_changed.wait(lock, [this]() { return pending_count == 0; });
+    if (first_failure) {
+      exception_ptr failure = first_failure;
+      first_failure = nullptr;
+      rethrow_exception(failure);
+    }
+  }
+
+private:
+  struct WorkerQueue {
+    mutex queue_mutex;
+    deque<Task> tasks;
+  };
+
+  // Pops a task from the worker's own queue, else steals one from another.
+  bool takeTask(int worker_index, Task &task) {
+    const size_t queue_count = queues.size();
+    for (size_t offset = 0; offset < queue_count; offset++) {
+      WorkerQueue &queue = *queues[(worker_index + offset) % queue_count];
+      lock_guard<mutex> lock(queue.queue_mutex);
+      if (queue.tasks.empty())
+        continue;
+      if (offset == 0) {
+        task = move(queue.tasks.front());
+        queue.tasks.pop_front();
+      } else {
+        task = move(queue.tasks.back());
+        queue.tasks.pop_back();
+      }
+      return true;
+    }
+    return false;
+  }
+
+  void workerLoop(int worker_index) {
+    while (true) {
+      Task task;
+      if (takeTask(worker_index, task)) {
+        {
+          lock_guard<mutex> lock(state_mutex);
+          queued_count--;
+        }
+        exception_ptr failure;
+        try {
+          task(worker_index);
+        } catch (...) {
+          failure = current_exception();
+        }
+        {
+          lock_guard<mutex> lock(state_mutex);
+          if (failure && !first_failure)
+            first_failure = failure;
+          pending_count--;
+        }
+        state_changed.notify_all();
+        continue;
+      }
+
+      // Nothing to run or steal: sleep until new work or shutdown. A queued
+      // task that another worker is about to take only costs a retry.
+      unique_lock<mutex> lock(state_mutex);
+      state_changed.wait(lock,
+                         [this]() { return stopping || queued_count > 0; });
+      if (stopping && queued_count == 0)
+        return;
+    }
+  }
+
+  vector<unique_ptr<WorkerQueue>> queues;
+  vector<thread> workers;
+
+  // Guards the counters, first_failure and stopping; signalled on every
+  // state change.
+  mutex state_mutex;
+  condition_variable state_changed;
+
+  // Number of submitted tasks that have not finished yet.
+  size_t pending_count;
+
+  // Number of submitted tasks no worker has taken yet.
+  size_t queued_count;
+
+  // First exception thrown by a task since the last wait().
+  exception_ptr first_failure;
+
+  // Round-robin cursor for submit().
+  atomic<size_t> next_queue;
+
+  // Set by the destructor to stop idle workers.
+  bool stopping;
+};
+
+#endif // INHA_ALGORITHM_003_WORK_STEALING_POOL_HPP
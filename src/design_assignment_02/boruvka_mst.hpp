@@ -0,0 +1,151 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-06-30
+ *
+ * Description: Builds the minimum spanning tree (a forest if the network is
+ * disconnected) with Borůvka's algorithm on several threads. Each round,
+ * threads scan slices of the live bridges and lower every component's best
+ * outgoing bridge with an atomic compare-and-swap, then unite the
+ * components along those bridges in a lock-free union-find. Bridge
+ * priorities form a strict total order, so the selected bridges are the
+ * same set Prim and Kruskal select.
+ */
+#ifndef INHA_ALGORITHM_003_BORUVKA_MST_HPP
+#define INHA_ALGORITHM_003_BORUVKA_MST_HPP
+
+#include "road_graph.hpp"
+#include "spanning_tree.hpp"
+#include "union_find.hpp"
+#include <atomic>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <thread>
+#include <vector>
+using namespace std;
+
+class BoruvkaMST : public SpanningTree {
+public:
+  explicit BoruvkaMST(const RoadGraph &graph, ostream &out = cout)
+      : SpanningTree(graph, out), thread_count(defaultThreadCount()),
+        round_count(0) {}
+
+  // Number of threads used by every round.
+  void setThreadCount(int count) { thread_count = (count < 1) ? 1 : count; }
+  int getThreadCount() const { return thread_count; }
+
+  // Number of rounds the last initializeMST() took.
+  int getRoundCount() const { return round_count; }
+
+  void initializeMST() {
+    const size_t city_count = graph.cityCount();
+    ConcurrentDisjointSet components(city_count);
+    vector<atomic<BridgeId>> best(city_count);
+    for (atomic<BridgeId> &slot : best)
+      slot.store(kNoBridge, memory_order_relaxed);
+
+    // Bridges that may still join two components; self-loops never do.
+    vector<BridgeId> live;
+    live.reserve(graph.bridgeCount());
+    for (BridgeId id = 0; id < graph.bridgeCount(); id++) {
+      if (graph.earlierCity(id) != graph.laterCity(id))
+        live.push_back(id);
+    }
+
+    vector<vector<BridgeId>> kept(thread_count);
+    vector<vector<BridgeId>> selected(thread_count);
+    round_count = 0;
+    while (!live.empty()) {
+      round_count++;
+
+      // Phase 1: each component's best outgoing bridge. Bridges inside a
+      // component are dropped from the live list for good.
+      runWorkers([&](int worker) {
+        vector<BridgeId> &worker_kept = kept[worker];
+        worker_kept.clear();
+        const size_t begin = live.size() * worker / thread_count;
+        const size_t end = live.size() * (worker + 1) / thread_count;
+        for (size_t i = begin; i < end; i++) {
+          const CityId first = components.find(graph.earlierCity(live[i]));
+          const CityId second = components.find(graph.laterCity(live[i]));
+          if (first == second)
+            continue;
+          worker_kept.push_back(live[i]);
+          offerBest(best[first], live[i]);
+          offerBest(best[second], live[i]);
+        }
+      });
+
+      // Phase 2: contract along every component's best bridge. A bridge
+      // chosen by both of its components unites them only once.
+      live.clear();
+      for (const vector<BridgeId> &worker_kept : kept)
+        live.insert(live.end(), worker_kept.begin(), worker_kept.end());
+      runWorkers([&](int worker) {
+        vector<BridgeId> &worker_selected = selected[worker];
+        worker_selected.clear();
+        const size_t begin = city_count * worker / thread_count;
+        const size_t end = city_count * (worker + 1) / thread_count;
+        for (size_t city = begin; city < end; city++) {
+          const BridgeId id = best[city].load(memory_order_relaxed);
+          if (id == kNoBridge)
+            continue;
+          best[city].store(kNoBridge, memory_order_relaxed);
+          if (components.unite(graph.earlierCity(id), graph.laterCity(id)))
+            worker_selected.push_back(id);
+        }
+      });
+
+      size_t selected_count = 0;
+      for (const vector<BridgeId> &worker_selected : selected) {
+        for (BridgeId id : worker_selected)
+          addBridge(id);
+        selected_count += worker_selected.size();
+      }
+      if (selected_count == 0)
+        break;
+    }
+  }
+
+private:
+  static constexpr BridgeId kNoBridge = numeric_limits<BridgeId>::max();
+
+  // Makes 'candidate' the bridge in 'slot' if it has higher priority than
+  // the bridge already there.
+  void offerBest(atomic<BridgeId> &slot, BridgeId candidate) const {
+    const PriorityKey &candidate_key = graph.priority(candidate);
+    BridgeId current = slot.load(memory_order_relaxed);
+    while (current == kNoBridge || candidate_key < graph.priority(current) ||
+           (candidate_key == graph.priority(current) && candidate < current)) {
+      if (slot.compare_exchange_weak(current, candidate,
+                                     memory_order_relaxed))
+        return;
+    }
+  }
+
+  // Runs 'work(worker)' for every worker index on its own thread (worker 0
+  // on the calling thread) and waits for all of them.
+  void runWorkers(const function<void(int)> &work) const {
+    vector<thread> workers;
+    for (int worker = 1; worker < thread_count; worker++)
+      workers.emplace_back(work, worker);
+    work(0);
+    for (thread &worker : workers)
+      worker.join();
+  }
+
+  // Number of threads used by every round
+  int thread_count;
+
+  // Rounds taken by the last initializeMST()
+  int round_count;
+};
+
+constexpr BridgeId BoruvkaMST::kNoBridge;
+
+#endif // INHA_ALGORITHM_003_BORUVKA_MST_HPP
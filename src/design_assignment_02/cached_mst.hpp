@@ -0,0 +1,196 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-07-03
+ *
+ * Description: Answers Prim's algorithm for many starting cities from one
+ * cached minimum spanning forest. Bridge priorities form a strict total
+ * order, so the forest is unique. Each step of Prim takes the
+ * highest-priority bridge leaving the tree, and by the cut property that
+ * bridge is a forest bridge; among forest bridges alone it is still the
+ * highest. Running Prim over the forest bridges therefore selects the same
+ * bridges in the same order as a run over the whole network, in O(V log V)
+ * per starting city instead of O(E log E).
+ */
+#ifndef INHA_ALGORITHM_003_CACHED_MST_HPP
+#define INHA_ALGORITHM_003_CACHED_MST_HPP
+
+#include "kruskal_mst.hpp"
+#include "road_graph.hpp"
+#include "spanning_tree.hpp"
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+using namespace std;
+
+// Forest bridges around each city, in CSR form.
+struct ForestAdjacency {
+  struct Entry {
+    // City at the other end of the bridge
+    CityId neighbor;
+
+    // Forest bridge
+    BridgeId bridge;
+  };
+
+  // Entries of city c are entries[offsets[c] .. offsets[c + 1])
+  vector<size_t> offsets;
+  vector<Entry> entries;
+};
+
+// Prim's algorithm over the forest bridges from one starting city. It prints
+// the discovery lines, then the total and bridge list through SpanningTree,
+// exactly as MST does for the same starting city.
+class ForestPrim : public SpanningTree {
+public:
+  // 'city_status' holds one char per city, all 'U'; they are 'U' again
+  // when initializeMST() returns.
+  ForestPrim(const RoadGraph &graph, ostream &out,
+             const ForestAdjacency &forest, vector<char> &city_status)
+      : SpanningTree(graph, out), forest(forest), city_status(city_status),
+        starting_city(kInvalidCity), bridge_order(graph, out) {}
+
+  // Select the starting city for Prim's algorithm
+  void setStartingNode(const string &starting_city_name) {
+    starting_city = graph.findCity(starting_city_name);
+  }
+
+  void initializeMST() {
+    if (starting_city == kInvalidCity)
+      return;
+    city_status[starting_city] = 'T';
+    pushBridges(starting_city);
+    LineWriter writer(out);
+
+    // A city outside a subtree touches at most one of its cities, so no
+    // candidate ever goes stale and each pop adds a city.
+    while (!bridge_heap.empty()) {
+      const BridgeId next_bridge = bridge_heap.front();
+      pop_heap(bridge_heap.begin(), bridge_heap.end(), bridge_order);
+      bridge_heap.pop_back();
+
+      const CityId first_city = graph.earlierCity(next_bridge);
+      const CityId second_city = graph.laterCity(next_bridge);
+      const CityId new_city =
+          (city_status[first_city] == 'T') ? second_city : first_city;
+      city_status[new_city] = 'T';
+
+      // Print intermediate information as required by the problem specification
+      writer.text(graph.cityName(first_city))
+          .character(' ')
+          .text(graph.cityName(second_city))
+          .endLine();
+
+      pushBridges(new_city);
+      addBridge(next_bridge);
+    }
+
+    // Reset only the cities this run touched.
+    city_status[starting_city] = 'U';
+    for (BridgeId bridge : mst_bridges) {
+      city_status[graph.earlierCity(bridge)] = 'U';
+      city_status[graph.laterCity(bridge)] = 'U';
+    }
+  }
+
+private:
+  // Pushes the forest bridges from Tree city 'city' to non-Tree cities.
+  void pushBridges(CityId city) {
+    for (size_t i = forest.offsets[city]; i < forest.offsets[city + 1]; i++) {
+      const ForestAdjacency::Entry &entry = forest.entries[i];
+      if (city_status[entry.neighbor] == 'T')
+        continue;
+      bridge_heap.push_back(entry.bridge);
+      push_heap(bridge_heap.begin(), bridge_heap.end(), bridge_order);
+    }
+  }
+
+  // Forest the run is restricted to
+  const ForestAdjacency &forest;
+
+  // 'U' (Unseen) or 'T' (Tree) per city, shared between runs
+  vector<char> &city_status;
+
+  // Store the starting vertex for Prim's algorithm
+  CityId starting_city;
+
+  // Priority order of the graph's bridges
+  BridgeComparator bridge_order;
+
+  // Candidate bridge IDs, ordered by BridgeComparator
+  BridgeHeap bridge_heap;
+};
+
+class CachedMST {
+public:
+  explicit CachedMST(const RoadGraph &graph, ostream &out = cout)
+      : graph(graph), out(out), thread_count(defaultThreadCount()),
+        city_status(graph.cityCount(), 'U') {}
+
+  // Number of threads used to sort the bridges for Kruskal.
+  void setThreadCount(int count) { thread_count = (count < 1) ? 1 : count; }
+  int getThreadCount() const { return thread_count; }
+
+  // Builds the minimum spanning forest once and lays out its bridges per
+  // city.
+  void initializeMST() {
+    KruskalMST kruskal(graph, out);
+    kruskal.setThreadCount(thread_count);
+    kruskal.initializeMST();
+    const BridgeHeap &bridges = kruskal.bridges();
+
+    forest.offsets.assign(graph.cityCount() + 1, 0);
+    for (BridgeId bridge : bridges) {
+      forest.offsets[graph.earlierCity(bridge) + 1]++;
+      forest.offsets[graph.laterCity(bridge) + 1]++;
+    }
+    for (size_t city = 0; city < graph.cityCount(); city++)
+      forest.offsets[city + 1] += forest.offsets[city];
+    forest.entries.resize(2 * bridges.size());
+    vector<size_t> cursor(forest.offsets.begin(), forest.offsets.end() - 1);
+    for (BridgeId bridge : bridges) {
+      const CityId first = graph.earlierCity(bridge);
+      const CityId second = graph.laterCity(bridge);
+      forest.entries[cursor[first]++] = {second, bridge};
+      forest.entries[cursor[second]++] = {first, bridge};
+    }
+  }
+
+  // Prints the discovery lines, total and bridge list of Prim's algorithm
+  // from 'starting_city_name', identical to a fresh MST run. Returns the
+  // total.
+  long long printFromStart(const string &starting_city_name) {
+    ForestPrim prim(graph, out, forest, city_status);
+    prim.setStartingNode(starting_city_name);
+    prim.initializeMST();
+    prim.printTotalElevationSum();
+    prim.printAllBridges();
+    return prim.totalLength();
+  }
+
+  // Number of forest bridges.
+  size_t bridgeCount() const { return forest.entries.size() / 2; }
+
+private:
+  // Graph the forest is built over
+  const RoadGraph &graph;
+
+  // Destination of every printed line
+  ostream &out;
+
+  // Number of threads used to sort the bridges
+  int thread_count;
+
+  // Forest bridges per city
+  ForestAdjacency forest;
+
+  // Vertex status reused by every query
+  vector<char> city_status;
+};
+
+#endif // INHA_ALGORITHM_003_CACHED_MST_HPP
@@ -0,0 +1,275 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-07-02
+ *
+ * Description: Minimum spanning tree (a forest if the network is
+ * disconnected) kept up to date while new bridges are approved. The tree is
+ * built once with Kruskal's algorithm and stored in a link-cut tree, where
+ * every tree bridge is a node of its own between its two cities. A new
+ * bridge either joins two trees, or closes a cycle whose lowest-priority
+ * bridge is found in O(log n) amortized and swapped out if the new bridge
+ * ranks above it. The total and the sorted bridge list are maintained along
+ * the way, so they are never recomputed.
+ */
+#ifndef INHA_ALGORITHM_003_DYNAMIC_MST_HPP
+#define INHA_ALGORITHM_003_DYNAMIC_MST_HPP
+
+#include "kruskal_mst.hpp"
+#include "link_cut_tree.hpp"
+#include "road_graph.hpp"
+#include "spanning_tree.hpp"
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+using namespace std;
+
+// A bridge of the dynamic tree. The timestamp is kept as text, since a new
+// bridge may carry a timestamp the network's rank table does not have.
+struct DynamicBridge {
+  // Lexicographically earlier city (the smaller ID)
+  CityId earlier_city;
+
+  // Lexicographically later city (the larger ID)
+  CityId later_city;
+
+  // Construction timestamp of the bridge (format: YYYY-MM)
+  string timestamp;
+
+  // Length of the bridge (in meters)
+  int road_length;
+
+  // Absolute elevation difference between the two connected cities
+  int road_length_diff;
+};
+
+// Whether 'a' has a lower maintenance priority than 'b', under the same
+// field order as BridgeComparator.
+inline bool lowerPriority(const DynamicBridge &a, const DynamicBridge &b) {
+  return tie(b.timestamp, b.road_length, b.road_length_diff, b.earlier_city,
+             b.later_city) < tie(a.timestamp, a.road_length,
+                                 a.road_length_diff, a.earlier_city,
+                                 a.later_city);
+}
+
+// Outcome of DynamicMST::addBridge().
+enum class BridgeInsertion {
+  // The bridge joined two trees
+  kLinked,
+  // The bridge replaced the lowest-priority bridge of the cycle it closed
+  kSwapped,
+  // The bridge ranks below every bridge of its cycle and was not kept
+  kRejected,
+  // One of the cities is not in the network; nothing changed
+  kUnknownCity
+};
+
+class DynamicMST {
+public:
+  explicit DynamicMST(const RoadGraph &graph, ostream &out = cout)
+      : graph(graph), out(out), city_count(graph.cityCount()),
+        tree(2 * graph.cityCount(), static_cast<uint32_t>(graph.cityCount()),
+             SlotOrder{&slots, static_cast<uint32_t>(graph.cityCount())}),
+        total_length(0), last_insertion(BridgeInsertion::kUnknownCity) {}
+
+  // Builds the tree of the network as it was read, with Kruskal's algorithm
+  // on 'thread_count' threads.
+  void initializeMST(int thread_count = defaultThreadCount()) {
+    KruskalMST kruskal(graph, out);
+    kruskal.setThreadCount(thread_count);
+    kruskal.initializeMST();
+    for (BridgeId bridge : kruskal.bridges()) {
+      DynamicBridge entry{graph.earlierCity(bridge), graph.laterCity(bridge),
+                          graph.timestampName(graph.timestamp(bridge)),
+                          graph.roadLength(bridge),
+                          graph.elevationDifference(bridge)};
+      linkBridge(move(entry));
+    }
+  }
+
+  // Approves a new bridge between two cities of the network and updates the
+  // tree.
+  BridgeInsertion addBridge(const string &first_city,
+                            const string &second_city, int road_length,
+                            const string &timestamp) {
+    const CityId first = graph.findCity(first_city);
+    const CityId second = graph.findCity(second_city);
+    if (first == kInvalidCity || second == kInvalidCity)
+      return last_insertion = BridgeInsertion::kUnknownCity;
+
+    DynamicBridge bridge{min(first, second), max(first, second), timestamp,
+                         road_length,
+                         abs(graph.elevation(first) - graph.elevation(second))};
+    last_added = bridge;
+    if (first == second) {
+      last_removed = move(bridge);
+      return last_insertion = BridgeInsertion::kRejected;
+    }
+    if (!tree.connected(first, second)) {
+      linkBridge(move(bridge));
+      return last_insertion = BridgeInsertion::kLinked;
+    }
+
+    // The bridge closes a cycle; it stays only if it beats the cycle's
+    // lowest-priority bridge.
+    const uint32_t worst_slot = tree.pathWorst(first, second) - city_count;
+    if (!lowerPriority(slots[worst_slot], bridge)) {
+      last_removed = move(bridge);
+      return last_insertion = BridgeInsertion::kRejected;
+    }
+    last_removed = slots[worst_slot];
+    cutBridge(worst_slot);
+    linkBridge(move(bridge));
+    return last_insertion = BridgeInsertion::kSwapped;
+  }
+
+  // Print the bridges the last addBridge() put into ("+") and took out of
+  // ("-") the tree, then the new total.
+  void printLastInsertion() const {
+    switch (last_insertion) {
+    case BridgeInsertion::kLinked:
+      printBridge("+ ", last_added);
+      break;
+    case BridgeInsertion::kSwapped:
+      printBridge("+ ", last_added);
+      printBridge("- ", last_removed);
+      break;
+    case BridgeInsertion::kRejected:
+      break;
+    case BridgeInsertion::kUnknownCity:
+      out << kUnexpectedErrorMessage << "\n";
+      break;
+    }
+    printTotalElevationSum();
+  }
+
+  // Print the total length of bridges to be maintained
+  void printTotalElevationSum() const {
+    LineWriter(out).integer(total_length).endLine();
+  }
+
+  // Print information of all bridges to be maintained, with each field
+  // separated by spaces. The list is kept sorted, so nothing is sorted here.
+  void printAllBridges() const {
+    for (const auto &entry : tree_bridges)
+      printBridge("", slots[entry.second]);
+  }
+
+  // Total length of the bridges in the tree.
+  long long totalLength() const { return total_length; }
+
+  // Number of bridges in the tree.
+  size_t bridgeCount() const { return tree_bridges.size(); }
+
+  // Bridges in the tree, in city order.
+  vector<DynamicBridge> bridges() const {
+    vector<DynamicBridge> list;
+    list.reserve(tree_bridges.size());
+    for (const auto &entry : tree_bridges)
+      list.push_back(slots[entry.second]);
+    return list;
+  }
+
+  // Bridges the last addBridge() put into and took out of the tree; the
+  // removed one is the new bridge itself if it was rejected.
+  const DynamicBridge &lastAdded() const { return last_added; }
+  const DynamicBridge &lastRemoved() const { return last_removed; }
+
+private:
+  // Orders link-cut tree nodes by the bridge in their slot.
+  struct SlotOrder {
+    bool operator()(uint32_t a, uint32_t b) const {
+      return lowerPriority((*slots)[a - first_slot_node],
+                           (*slots)[b - first_slot_node]);
+    }
+
+    const vector<DynamicBridge> *slots;
+    uint32_t first_slot_node;
+  };
+
+  void printBridge(const char *prefix, const DynamicBridge &bridge) const {
+    LineWriter(out)
+        .text(prefix)
+        .text(bridge.timestamp)
+        .character(' ')
+        .text(graph.cityName(bridge.earlier_city))
+        .character(' ')
+        .text(graph.cityName(bridge.later_city))
+        .character(' ')
+        .integer(bridge.road_length)
+        .endLine();
+  }
+
+  // Stores 'bridge' in a free slot and links it between its two cities,
+  // which must be in different trees.
+  void linkBridge(DynamicBridge bridge) {
+    uint32_t slot;
+    if (free_slots.empty()) {
+      slot = static_cast<uint32_t>(slots.size());
+      slots.push_back(move(bridge));
+    } else {
+      slot = free_slots.back();
+      free_slots.pop_back();
+      slots[slot] = move(bridge);
+    }
+    const DynamicBridge &stored = slots[slot];
+    const uint32_t node = city_count + slot;
+    tree.link(node, stored.earlier_city);
+    tree.link(node, stored.later_city);
+    tree_bridges[make_pair(stored.earlier_city, stored.later_city)] = slot;
+    total_length += stored.road_length;
+  }
+
+  // Unlinks the bridge in 'slot' from its cities and frees the slot.
+  void cutBridge(uint32_t slot) {
+    const DynamicBridge &bridge = slots[slot];
+    const uint32_t node = city_count + slot;
+    tree.cut(node, bridge.earlier_city);
+    tree.cut(node, bridge.later_city);
+    tree.reset(node);
+    tree_bridges.erase(make_pair(bridge.earlier_city, bridge.later_city));
+    total_length -= bridge.road_length;
+    free_slots.push_back(slot);
+  }
+
+  // Graph the tree is built over
+  const RoadGraph &graph;
+
+  // Destination of every printed line
+  ostream &out;
+
+  // Nodes 0 .. city_count-1 are cities; node city_count + s holds slot s
+  uint32_t city_count;
+
+  // Tree bridges by slot; a forest has fewer bridges than cities, so the
+  // slots never outgrow the link-cut tree
+  vector<DynamicBridge> slots;
+
+  // Slots freed by swapped-out bridges
+  vector<uint32_t> free_slots;
+
+  // Cities and tree bridges, with the lowest-priority bridge on each path
+  LinkCutTree<SlotOrder> tree;
+
+  // Slot of every tree bridge, sorted by (earlier city, later city)
+  map<pair<CityId, CityId>, uint32_t> tree_bridges;
+
+  // Total length of the tree bridges
+  long long total_length;
+
+  // What the last addBridge() did, and the bridges it involved
+  BridgeInsertion last_insertion;
+  DynamicBridge last_added;
+  DynamicBridge last_removed;
+};
+
+#endif // INHA_ALGORITHM_003_DYNAMIC_MST_HPP
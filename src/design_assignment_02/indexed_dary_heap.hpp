@@ -0,0 +1,143 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-06-22
+ *
+ * Description: Indexed d-ary heap over the dense IDs 0 .. capacity-1. Each ID
+ * is in the heap at most once with one value, and a better value can be
+ * applied in place (decrease-key). Compare follows the std::push_heap
+ * convention: the top is the value no other value compares greater than.
+ */
+#ifndef INHA_ALGORITHM_003_INDEXED_DARY_HEAP_HPP
+#define INHA_ALGORITHM_003_INDEXED_DARY_HEAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+using namespace std;
+
+template <typename Value, typename Compare, size_t Arity = 4>
+class IndexedDaryHeap {
+public:
+  static_assert(Arity >= 2, "a heap node needs at least two children");
+
+  explicit IndexedDaryHeap(size_t capacity, Compare compare = Compare())
+      : values(capacity), positions(capacity, kAbsent), compare(compare),
+        peak_size(0) {}
+
+  bool empty() const { return heap.empty(); }
+  size_t size() const { return heap.size(); }
+
+  // Largest size() reached so far.
+  size_t peakSize() const { return peak_size; }
+
+  // Whether 'id' is currently in the heap.
+  bool contains(uint32_t id) const { return positions[id] != kAbsent; }
+
+  // Value held for 'id'; only meaningful while contains(id).
+  const Value &value(uint32_t id) const { return values[id]; }
+
+  // ID and value at the top of the heap.
+  uint32_t top() const { return heap.front(); }
+  const Value &topValue() const { return values[heap.front()]; }
+
+  // Inserts 'id' with 'value', or gives it 'value' if that ranks above the
+  // value it holds. Returns false if the heap was left unchanged.
+  bool pushOrImprove(uint32_t id, const Value &value) {
+    uint32_t position = positions[id];
+    if (position == kAbsent) {
+      values[id] = value;
+      position = static_cast<uint32_t>(heap.size());
+      heap.push_back(id);
+      positions[id] = position;
+      if (heap.size() > peak_size)
+        peak_size = heap.size();
+      siftUp(position);
+      return true;
+    }
+    if (!compare(values[id], value))
+      return false;
+    values[id] = value;
+    siftUp(position);
+    return true;
+  }
+
+  // Removes the top ID.
+  void pop() {
+    positions[heap.front()] = kAbsent;
+    const uint32_t last = heap.back();
+    heap.pop_back();
+    if (!heap.empty()) {
+      heap[0] = last;
+      positions[last] = 0;
+      siftDown(0);
+    }
+  }
+
+private:
+  static constexpr uint32_t kAbsent = numeric_limits<uint32_t>::max();
+
+  // Moves the ID at 'position' toward the root while it outranks its parent.
+  void siftUp(uint32_t position) {
+    const uint32_t id = heap[position];
+    while (position > 0) {
+      const uint32_t parent = (position - 1) / Arity;
+      if (!compare(values[heap[parent]], values[id]))
+        break;
+      heap[position] = heap[parent];
+      positions[heap[position]] = position;
+      position = parent;
+    }
+    heap[position] = id;
+    positions[id] = position;
+  }
+
+  // Moves the ID at 'position' toward the leaves while a child outranks it.
+  void siftDown(uint32_t position) {
+    const uint32_t id = heap[position];
+    const size_t count = heap.size();
+    while (true) {
+      const size_t first_child = static_cast<size_t>(position) * Arity + 1;
+      if (first_child >= count)
+        break;
+      const size_t last_child =
+          (first_child + Arity < count) ? first_child + Arity : count;
+      size_t best = first_child;
+      for (size_t child = first_child + 1; child < last_child; child++) {
+        if (compare(values[heap[best]], values[heap[child]]))
+          best = child;
+      }
+      if (!compare(values[id], values[heap[best]]))
+        break;
+      heap[position] = heap[best];
+      positions[heap[position]] = position;
+      position = static_cast<uint32_t>(best);
+    }
+    heap[position] = id;
+    positions[id] = position;
+  }
+
+  // Heap-ordered IDs.
+  vector<uint32_t> heap;
+
+  // Value of each ID, indexed by ID.
+  vector<Value> values;
+
+  // Index of each ID in 'heap', or kAbsent.
+  vector<uint32_t> positions;
+
+  Compare compare;
+
+  // Largest heap.size() so far.
+  size_t peak_size;
+};
+
+template <typename Value, typename Compare, size_t Arity>
+constexpr uint32_t IndexedDaryHeap<Value, Compare, Arity>::kAbsent;
+
+#endif // INHA_ALGORITHM_003_INDEXED_DARY_HEAP_HPP
@@ -0,0 +1,75 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-06-30
+ *
+ * Description: Builds the minimum spanning tree (a forest if the network is
+ * disconnected) with Kruskal's algorithm. Every bridge is sorted by its
+ * priority key in parallel, then a union-find keeps each bridge that joins
+ * two different components. There is no discovery order; only the total and
+ * the bridge list are reported, through the same SpanningTree output as
+ * Prim.
+ */
+#ifndef INHA_ALGORITHM_003_KRUSKAL_MST_HPP
+#define INHA_ALGORITHM_003_KRUSKAL_MST_HPP
+
+#include "parallel_sort.hpp"
+#include "road_graph.hpp"
+#include "spanning_tree.hpp"
+#include "union_find.hpp"
+#include <iostream>
+#include <vector>
+using namespace std;
+
+class KruskalMST : public SpanningTree {
+public:
+  explicit KruskalMST(const RoadGraph &graph, ostream &out = cout)
+      : SpanningTree(graph, out), thread_count(defaultThreadCount()) {}
+
+  // Number of threads used to sort the bridges.
+  void setThreadCount(int count) { thread_count = (count < 1) ? 1 : count; }
+  int getThreadCount() const { return thread_count; }
+
+  void initializeMST() {
+    // Sort (key, bridge) pairs so that comparisons never chase a pointer.
+    vector<KeyedBridge> order(graph.bridgeCount());
+    for (BridgeId id = 0; id < graph.bridgeCount(); id++) {
+      order[id].priority = graph.priority(id);
+      order[id].bridge = id;
+    }
+    parallelSort(order, keyedBridgeOrder, thread_count);
+
+    // Keep each bridge that joins two components, in priority order.
+    DisjointSet components(graph.cityCount());
+    const size_t tree_size =
+        (graph.cityCount() > 0) ? graph.cityCount() - 1 : 0;
+    for (const KeyedBridge &entry : order) {
+      if (mst_bridges.size() == tree_size)
+        break;
+      if (components.unite(graph.earlierCity(entry.bridge),
+                           graph.laterCity(entry.bridge)))
+        addBridge(entry.bridge);
+    }
+  }
+
+private:
+  // A bridge with its priority key copied next to it.
+  struct KeyedBridge {
+    PriorityKey priority;
+    BridgeId bridge;
+  };
+
+  // Ascending priority key, i.e. highest maintenance priority first.
+  static bool keyedBridgeOrder(const KeyedBridge &a, const KeyedBridge &b) {
+    return a.priority < b.priority;
+  }
+
+  // Number of threads used to sort the bridges
+  int thread_count;
+};
+
+#endif // INHA_ALGORITHM_003_KRUSKAL_MST_HPP
@@ -0,0 +1,226 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-06-27
+ *
+ * Description: Link-cut tree (Sleator-Tarjan) over the dense node IDs
+ * 0 .. capacity-1, with splay trees on preferred paths. Every node at or
+ * above 'first_valued_node' carries a value, and each splay subtree keeps
+ * its worst valued node, so the worst value on any tree path is found in
+ * O(log n) amortized. Worse(a, b) tells whether node a's value ranks below
+ * node b's.
+ */
+#ifndef INHA_ALGORITHM_003_LINK_CUT_TREE_HPP
+#define INHA_ALGORITHM_003_LINK_CUT_TREE_HPP
+
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+using namespace std;
+
+template <typename Worse> class LinkCutTree {
+public:
+  static constexpr uint32_t kNil = numeric_limits<uint32_t>::max();
+
+  LinkCutTree(size_t capacity, uint32_t first_valued_node,
+              Worse worse = Worse())
+      : nodes(capacity), first_valued_node(first_valued_node), worse(worse) {
+    for (size_t i = 0; i < capacity; i++)
+      nodes[i].worst = isValued(static_cast<uint32_t>(i))
+                           ? static_cast<uint32_t>(i)
+                           : kNil;
+  }
+
+  // Whether 'a' and 'b' are in the same tree.
+  bool connected(uint32_t a, uint32_t b) {
+    return a == b || findRoot(a) == findRoot(b);
+  }
+
+  // Joins the trees of 'a' and 'b' with the edge (a, b). They must not be
+  // connected yet.
+  void link(uint32_t a, uint32_t b) {
+    makeRoot(a);
+    nodes[a].parent = b;
+  }
+
+  // Removes the edge (a, b), which must exist.
+  void cut(uint32_t a, uint32_t b) {
+    makeRoot(a);
+    access(b);
+    splay(b);
+    // a is now b's left child with no right child of its own.
+    nodes[b].child[0] = kNil;
+    nodes[a].parent = kNil;
+    update(b);
+  }
+
+  // Worst valued node on the path between connected 'a' and 'b' (kNil if
+  // the path has no valued node).
+  uint32_t pathWorst(uint32_t a, uint32_t b) {
+    makeRoot(a);
+    access(b);
+    splay(b);
+    return nodes[b].worst;
+  }
+
+  // Resets 'node' to a single-node tree, e.g. to reuse a freed valued node.
+  // The node must already be cut from every neighbor.
+  void reset(uint32_t node) {
+    Node &entry = nodes[node];
+    entry.child[0] = entry.child[1] = entry.parent = kNil;
+    entry.reversed = false;
+    entry.worst = isValued(node) ? node : kNil;
+  }
+
+private:
+  struct Node {
+    Node() : parent(kNil), worst(kNil), reversed(false) {
+      child[0] = child[1] = kNil;
+    }
+
+    uint32_t child[2];
+
+    // Splay parent, or path-parent if this node is a splay root
+    uint32_t parent;
+
+    // Worst valued node in this splay subtree, or kNil
+    uint32_t worst;
+
+    // Children of this subtree still have to be swapped
+    bool reversed;
+  };
+
+  bool isValued(uint32_t node) const { return node >= first_valued_node; }
+
+  // Whether 'node' is the root of its splay tree.
+  bool isSplayRoot(uint32_t node) const {
+    uint32_t parent = nodes[node].parent;
+    return parent == kNil || (nodes[parent].child[0] != node &&
+                              nodes[parent].child[1] != node);
+  }
+
+  // The worse of two candidates, either of which may be kNil.
+  uint32_t worseOf(uint32_t a, uint32_t b) const {
+    if (a == kNil)
+      return b;
+    if (b == kNil)
+      return a;
+    return worse(a, b) ? a : b;
+  }
+
+  void update(uint32_t node) {
+    Node &entry = nodes[node];
+    uint32_t worst = isValued(node) ? node : kNil;
+    if (entry.child[0] != kNil)
+      worst = worseOf(worst, nodes[entry.child[0]].worst);
+    if (entry.child[1] != kNil)
+      worst = worseOf(worst, nodes[entry.child[1]].worst);
+    entry.worst = worst;
+  }
+
+  void pushDown(uint32_t node) {
+    Node &entry = nodes[node];
+    if (!entry.reversed)
+      return;
+    swap(entry.child[0], entry.child[1]);
+    for (uint32_t child : entry.child) {
+      if (child != kNil)
+        nodes[child].reversed = !nodes[child].reversed;
+    }
+    entry.reversed = false;
+  }
+
+  void rotate(uint32_t node) {
+    const uint32_t parent = nodes[node].parent;
+    const uint32_t grandparent = nodes[parent].parent;
+    const int side = (nodes[parent].child[1] == node) ? 1 : 0;
+    const uint32_t moved = nodes[node].child[side ^ 1];
+
+    if (!isSplayRoot(parent)) {
+      Node &above = nodes[grandparent];
+      above.child[(above.child[1] == parent) ? 1 : 0] = node;
+    }
+    nodes[node].parent = grandparent;
+
+    nodes[node].child[side ^ 1] = parent;
+    nodes[parent].parent = node;
+    nodes[parent].child[side] = moved;
+    if (moved != kNil)
+      nodes[moved].parent = parent;
+
+    update(parent);
+    update(node);
+  }
+
+  void splay(uint32_t node) {
+    // Push pending reversals down from the splay root first.
+    path.clear();
+    for (uint32_t up = node;; up = nodes[up].parent) {
+      path.push_back(up);
+      if (isSplayRoot(up))
+        break;
+    }
+    for (size_t i = path.size(); i-- > 0;)
+      pushDown(path[i]);
+
+    while (!isSplayRoot(node)) {
+      const uint32_t parent = nodes[node].parent;
+      if (!isSplayRoot(parent)) {
+        const uint32_t grandparent = nodes[parent].parent;
+        const bool zigzig = (nodes[grandparent].child[0] == parent) ==
+                            (nodes[parent].child[0] == node);
+        rotate(zigzig ? parent : node);
+      }
+      rotate(node);
+    }
+  }
+
+  // Makes the path from the root to 'node' preferred, ending at 'node'.
+  void access(uint32_t node) {
+    uint32_t last = kNil;
+    for (uint32_t up = node; up != kNil; up = nodes[up].parent) {
+      splay(up);
+      nodes[up].child[1] = last;
+      update(up);
+      last = up;
+    }
+    splay(node);
+  }
+
+  void makeRoot(uint32_t node) {
+    access(node);
+    nodes[node].reversed = !nodes[node].reversed;
+    pushDown(node);
+  }
+
+  uint32_t findRoot(uint32_t node) {
+    access(node);
+    uint32_t root = node;
+    pushDown(root);
+    while (nodes[root].child[0] != kNil) {
+      root = nodes[root].child[0];
+      pushDown(root);
+    }
+    splay(root);
+    return root;
+  }
+
+  vector<Node> nodes;
+
+  // Nodes below this ID carry no value
+  uint32_t first_valued_node;
+
+  Worse worse;
+
+  // Scratch stack for splay()
+  vector<uint32_t> path;
+};
+
+template <typename Worse> constexpr uint32_t LinkCutTree<Worse>::kNil;
+
+#endif // INHA_ALGORITHM_003_LINK_CUT_TREE_HPP
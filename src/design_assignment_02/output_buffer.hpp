@@ -0,0 +1,136 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-07-02
+ *
+ * Description: Bulk output for the MST reports. BulkOutputBuffer takes over
+ * a stream's buffer with a large one of its own and passes it on in big
+ * chunks, so a report of a million lines costs a handful of writes instead
+ * of a flush per line. Everything written to the stream, from any printer,
+ * goes through the same buffer, so the order of the lines never changes.
+ * LineWriter appends names and integers straight to a stream's buffer,
+ * skipping the per-insertion sentry and locale formatting of operator<<.
+ */
+#ifndef INHA_ALGORITHM_003_OUTPUT_BUFFER_HPP
+#define INHA_ALGORITHM_003_OUTPUT_BUFFER_HPP
+
+#include <cstddef>
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+using namespace std;
+
+class BulkOutputBuffer : public streambuf {
+public:
+  // Bytes held before they are passed on
+  static constexpr size_t kDefaultCapacity = 1 << 20;
+
+  // Installs the buffer on 'stream' until destruction.
+  explicit BulkOutputBuffer(ostream &stream,
+                            size_t capacity = kDefaultCapacity)
+      : stream(stream), sink(stream.rdbuf()),
+        buffer(capacity > 0 ? capacity : 1) {
+    setp(buffer.data(), buffer.data() + buffer.size());
+    stream.rdbuf(this);
+  }
+
+  // Passes on what is left and gives 'stream' its own buffer back.
+  ~BulkOutputBuffer() override {
+    sync();
+    stream.rdbuf(sink);
+  }
+
+  BulkOutputBuffer(const BulkOutputBuffer &) = delete;
+  BulkOutputBuffer &operator=(const BulkOutputBuffer &) = delete;
+
+protected:
+  int overflow(int c) override {
+    if (!drain())
+      return traits_type::eof();
+    if (!traits_type::eq_int_type(c, traits_type::eof())) {
+      *pptr() = traits_type::to_char_type(c);
+      pbump(1);
+    }
+    return traits_type::not_eof(c);
+  }
+
+  int sync() override {
+    if (!drain())
+      return -1;
+    return (sink == nullptr || sink->pubsync() == 0) ? 0 : -1;
+  }
+
+private:
+  // Hands the buffered bytes to the stream's own buffer. A stream without
+  // one drops them, as it would have.
+  bool drain() {
+    const streamsize pending = pptr() - pbase();
+    bool ok = true;
+    if (pending > 0 && sink != nullptr)
+      ok = (sink->sputn(pbase(), pending) == pending);
+    setp(buffer.data(), buffer.data() + buffer.size());
+    return ok;
+  }
+
+  // Stream the buffer is installed on
+  ostream &stream;
+
+  // The stream's own buffer, where the bytes end up
+  streambuf *sink;
+
+  // Bytes not yet passed on
+  vector<char> buffer;
+};
+
+constexpr size_t BulkOutputBuffer::kDefaultCapacity;
+
+// Appends the fields of report lines to a stream's buffer.
+class LineWriter {
+public:
+  explicit LineWriter(ostream &out) : sink(out.rdbuf()) {}
+
+  LineWriter &text(const string &value) {
+    if (sink != nullptr)
+      sink->sputn(value.data(), static_cast<streamsize>(value.size()));
+    return *this;
+  }
+
+  LineWriter &character(char value) {
+    if (sink != nullptr)
+      sink->sputc(value);
+    return *this;
+  }
+
+  // Decimal digits of 'value', as operator<< prints them.
+  LineWriter &integer(long long value) {
+    char digits[24];
+    char *end = digits + sizeof(digits);
+    char *begin = end;
+    // Negate as unsigned, so the smallest value does not overflow.
+    unsigned long long magnitude =
+        (value < 0) ? 0ULL - static_cast<unsigned long long>(value)
+                    : static_cast<unsigned long long>(value);
+    do {
+      *--begin = static_cast<char>('0' + magnitude % 10);
+      magnitude /= 10;
+    } while (magnitude != 0);
+    if (value < 0)
+      *--begin = '-';
+    if (sink != nullptr)
+      sink->sputn(begin, end - begin);
+    return *this;
+  }
+
+  LineWriter &endLine() { return character('\n'); }
+
+private:
+  // Buffer of the stream written to; null for a stream that drops output
+  streambuf *sink;
+};
+
+#endif // INHA_ALGORITHM_003_OUTPUT_BUFFER_HPP
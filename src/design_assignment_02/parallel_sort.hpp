@@ -0,0 +1,130 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-06-24
+ *
+ * Description: Multi-threaded merge sort for large vectors. Each thread sorts
+ * one slice with std::sort, then pairs of sorted runs are merged round by
+ * round; a merge is itself split across threads by cutting the first run
+ * evenly and binary-searching the matching cut in the second.
+ */
+#ifndef INHA_ALGORITHM_003_PARALLEL_SORT_HPP
+#define INHA_ALGORITHM_003_PARALLEL_SORT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+using namespace std;
+
+// Below this many elements per thread a single std::sort is faster.
+static constexpr size_t kParallelSortMinSlice = 1 << 15;
+
+// Merges the sorted runs [a_begin, a_end) and [b_begin, b_end) into 'out'
+// using 'thread_count' threads (joined before returning).
+template <typename T, typename Compare>
+static void parallelMerge(const T *a_begin, const T *a_end, const T *b_begin,
+                          const T *b_end, T *out, Compare compare,
+                          int thread_count) {
+  const size_t a_size = static_cast<size_t>(a_end - a_begin);
+  if (thread_count <= 1 || a_size < kParallelSortMinSlice) {
+    merge(a_begin, a_end, b_begin, b_end, out, compare);
+    return;
+  }
+
+  // Cut i takes a_begin[a_cut[i] ..) and the part of b that sorts before it.
+  vector<size_t> a_cut(thread_count + 1), b_cut(thread_count + 1);
+  for (int i = 0; i <= thread_count; i++) {
+    a_cut[i] = a_size * i / thread_count;
+    b_cut[i] = (i == thread_count)
+                   ? static_cast<size_t>(b_end - b_begin)
+                   : static_cast<size_t>(
+                         lower_bound(b_begin, b_end, a_begin[a_cut[i]],
+                                     compare) -
+                         b_begin);
+  }
+  b_cut[0] = 0;
+
+  vector<thread> workers;
+  for (int i = 0; i < thread_count; i++) {
+    workers.emplace_back([=, &a_cut, &b_cut]() {
+      merge(a_begin + a_cut[i], a_begin + a_cut[i + 1], b_begin + b_cut[i],
+            b_begin + b_cut[i + 1], out + a_cut[i] + b_cut[i], compare);
+    });
+  }
+  for (thread &worker : workers)
+    worker.join();
+}
+
+// Sorts 'values' by 'compare' on up to 'thread_count' threads. Equal
+// elements may be reordered, as with std::sort.
+template <typename T, typename Compare>
+void parallelSort(vector<T> &values, Compare compare, int thread_count) {
+  const size_t count = values.size();
+  if (thread_count > static_cast<int>(count / kParallelSortMinSlice))
+    thread_count = static_cast<int>(count / kParallelSortMinSlice);
+  if (thread_count <= 1) {
+    sort(values.begin(), values.end(), compare);
+    return;
+  }
+
+  // Sort one slice per thread.
+  vector<size_t> bounds(thread_count + 1);
+  for (int i = 0; i <= thread_count; i++)
+    bounds[i] = count * i / thread_count;
+  {
+    vector<thread> workers;
+    for (int i = 0; i < thread_count; i++) {
+      workers.emplace_back([&, i]() {
+        sort(values.begin() + bounds[i], values.begin() + bounds[i + 1],
+             compare);
+      });
+    }
+    for (thread &worker : workers)
+      worker.join();
+  }
+
+  // Merge neighbouring runs until one is left, ping-ponging two buffers.
+  vector<T> buffer(count);
+  T *source = values.data();
+  T *target = buffer.data();
+  while (bounds.size() > 2) {
+    const size_t run_count = bounds.size() - 1;
+    const size_t pair_count = run_count / 2;
+    const int threads_per_merge =
+        max(1, thread_count / static_cast<int>(pair_count));
+
+    vector<thread> mergers;
+    vector<size_t> next_bounds(1, 0);
+    for (size_t pair = 0; pair < pair_count; pair++) {
+      const size_t begin = bounds[2 * pair];
+      const size_t middle = bounds[2 * pair + 1];
+      const size_t end = bounds[2 * pair + 2];
+      mergers.emplace_back([=]() {
+        parallelMerge(source + begin, source + middle, source + middle,
+                      source + end, target + begin, compare,
+                      threads_per_merge);
+      });
+      next_bounds.push_back(end);
+    }
+    if (run_count % 2 == 1) {
+      // An odd run out is copied unchanged.
+      copy(source + bounds[run_count - 1], source + count,
+           target + bounds[run_count - 1]);
+      next_bounds.push_back(count);
+    }
+    for (thread &merger : mergers)
+      merger.join();
+
+    swap(source, target);
+    bounds.swap(next_bounds);
+  }
+  if (source != values.data())
+    values.swap(buffer);
+}
+
+#endif // INHA_ALGORITHM_003_PARALLEL_SORT_HPP
@@ -5,243 +5,65 @@
  * For full license text, see the LICENSE file in the root directory or at
  * https://opensource.org/license/mit
  * Author: Junho Kim
- * Latest Updated Date: 2025-06-01
+ * Latest Updated Date: 2025-07-02
  *
  * Description: Builds a Minimum Spanning Tree using Prim's algorithm and
  * outputs selected bridges. (Note: The problem refers to these as 'roads'.)
+ * City names are interned into a CSR RoadGraph while reading, so the
+ * algorithm itself only touches integer IDs.
+ *
+ * Usage:
+ *   ./INHA_Prim_Algorithm_003 [--eager]
+ *     Reads the network from stdin and writes the MST to stdout. With
+ *     --eager, Prim keeps one candidate bridge per fringe city in an indexed
+ *     heap instead of every bridge; the output is the same.
+ *   ./INHA_Prim_Algorithm_003 --kruskal [--threads N]
+ *     Builds the tree with Kruskal's algorithm over the whole network, with
+ *     the bridge sort on N threads. Only the total and the bridge list are
+ *     printed (no discovery order); the starting city is read and ignored.
+ *   ./INHA_Prim_Algorithm_003 --boruvka [--threads N]
+ *     Same report as --kruskal, built by Borůvka's algorithm on N threads.
+ *   ./INHA_Prim_Algorithm_003 --forest [--threads N]
+ *     Grows a tree in every connected component on N threads. Prints the
+ *     component count, then per component "<start city> <city count>" and
+ *     that tree's usual output. The starting city's component comes first;
+ *     the others follow by smallest city name and start from that city.
+ *   ./INHA_Prim_Algorithm_003 --dynamic [--threads N]
+ *     Builds the --kruskal tree, then reads a count and that many new
+ *     bridges after the starting city, in the road format. For each new
+ *     bridge it prints "+ <bridge>" if the bridge entered the tree,
+ *     "- <bridge>" for the bridge it replaced, and the new total. The final
+ *     total and bridge list follow.
+ *   ./INHA_Prim_Algorithm_003 --multi-start [--threads N]
+ *     Reads a count and that many more starting cities after the first one.
+ *     Builds the minimum spanning forest once, then prints the usual output
+ *     for every starting city in turn, each computed by Prim's algorithm
+ *     over the forest bridges only.
+ *   ./INHA_Prim_Algorithm_003 --convert FILE
+ *     Reads the network from stdin as usual and writes it to FILE in the
+ *     binary road-network format instead of building a tree.
+ *   ./INHA_Prim_Algorithm_003 [mode] --graph FILE
+ *     Maps the network from a FILE written by --convert; stdin then starts
+ *     at the starting city, followed by whatever the mode reads after it.
+ *     Works with every mode above and prints the same output.
  */
-#include <algorithm>
-#include <cmath>
+#include "boruvka_mst.hpp"
+#include "cached_mst.hpp"
+#include "dynamic_mst.hpp"
+#include "kruskal_mst.hpp"
+#include "output_buffer.hpp"
+#include "prim_mst.hpp"
+#include "road_graph.hpp"
+#include "road_graph_file.hpp"
+#include "spanning_forest.hpp"
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
-#include <map>
 #include <string>
-#include <unordered_map>
-#include <vector>
 using namespace std;
 
-class Node;
-class Bridge;
-class MST;
-
-// Map city names to their elevation values
-typedef map<string, int> CityElevationMap;
-
-// Store the list of bridges connected to each city (adjacency list)
-typedef unordered_map<string, vector<Bridge *>> BridgeGraph;
-
-// Map city names to their corresponding Node objects
-typedef map<string, Node *> CityNodeMap;
-
-// Store a collection of Bridge pointers used as a heap or list
-typedef vector<Bridge *> BridgeHeap;
-
-CityElevationMap city_elevation_map;
-BridgeGraph graph;
-CityNodeMap city_node_map;
-BridgeHeap bridge_heap;
-
-// Message: Should never happen if logic is correct (guard message).
-static constexpr const char *kUnexpectedErrorMessage =
-    "Algorithm error! You must solve this problem.";
-
-// Define a class that manages the city name and the status of the vertex
-class Node {
-public:
-  Node(const string &city) : city(city), status('U') {}
-
-private:
-  // Track the current status of the vertex: 'U' (Unseen), 'F' (Fringe), or 'T'
-  // (Tree)
-  char status;
-
-  // Store the name of the city represented by this node
-  string city;
-
-  friend class MST;
-};
-
-// Define a class that manages a bridge connecting two cities
-class Bridge {
-public:
-  Bridge(const string &first_city, const string &second_city,
-         const int &road_length, const string &timestamp)
-      : road_length(road_length), timestamp(timestamp) {
-
-    // Initialize the lexicographically earlier and later city names
-    initializeCities(first_city, second_city);
-    // Calculate the elevation difference between the two cities
-    initializeHeightDifference();
-  }
-
-  // Initialize the lexicographically earlier and later city names
-  void initializeCities(const string &first_city, const string &second_city) {
-    return (first_city <= second_city) ? storeCities(first_city, second_city)
-                                       : storeCities(second_city, first_city);
-  }
-
-  // Calculate the elevation difference between the two cities
-  void initializeHeightDifference() {
-    if (city_elevation_map.find(earlier_city) == city_elevation_map.end() ||
-        city_elevation_map.find(later_city) == city_elevation_map.end()) {
-      cout << kUnexpectedErrorMessage << "\n";
-      return;
-    }
-
-    // Get elevation of the earlier city in lexicographic order
-    int earlier_city_height = city_elevation_map[earlier_city];
-    // Get elevation of the later city in lexicographic order
-    int later_city_height = city_elevation_map[later_city];
-
-    // Calculate the difference in elevation between the two cities
-    this->road_length_diff = abs(earlier_city_height - later_city_height);
-  }
-
-  // Store the earlier and later city names based on lexicographic order
-  void storeCities(const string &earlier_city, const string &later_city) {
-    this->earlier_city = earlier_city;
-    this->later_city = later_city;
-  }
-
-private:
-  // Store the lexicographically earlier city name
-  string earlier_city;
-
-  // Store the lexicographically later city name
-  string later_city;
-
-  // Store the construction timestamp of the bridge (format: YYYY-MM)
-  string timestamp;
-
-  // Store the length of the bridge (in meters)
-  int road_length;
-
-  // Store the absolute elevation difference between the two connected cities
-  int road_length_diff;
-
-  friend struct BridgeComparator;
-  friend class MST;
-};
-
-// Define a comparator struct that determines the maintenance priority of
-// bridges (roads)
-struct BridgeComparator {
-  bool operator()(Bridge *a, Bridge *b) const {
-    if (a->timestamp != b->timestamp)
-      return a->timestamp > b->timestamp;
-    if (a->road_length != b->road_length)
-      return a->road_length > b->road_length;
-    if (a->road_length_diff != b->road_length_diff)
-      return a->road_length_diff > b->road_length_diff;
-    if (a->earlier_city != b->earlier_city)
-      return a->earlier_city > b->earlier_city;
-    if (a->later_city != b->later_city)
-      return a->later_city > b->later_city;
-
-    cout << kUnexpectedErrorMessage << "\n";
-    return false;
-  }
-};
-
-class MST {
-public:
-  MST() : starting_node(nullptr), total_length(0) {}
-
-  // Select the starting city for Prim's algorithm
-  void setStartingNode(const string &starting_city) {
-    starting_node = city_node_map[starting_city];
-    // Update the vertex status to Tree
-    starting_node->status = 'T';
-
-    // Insert the bridges adjacent to the starting vertex into the priority
-    // queue
-    for (Bridge *bridge : graph[starting_city]) {
-      bridge_heap.push_back(bridge);
-      push_heap(bridge_heap.begin(), bridge_heap.end(), BridgeComparator{});
-    }
-  }
-
-  void initializeMST() {
-    // Repeat until no fringe vertices remain
-    while (!bridge_heap.empty()) {
-      // Get the highest-priority bridge currently at the front of the priority
-      // queue
-      Bridge *next_bridge = bridge_heap.front();
-      pop_heap(bridge_heap.begin(), bridge_heap.end(), BridgeComparator{});
-      bridge_heap.pop_back();
-
-      Node *first_node = city_node_map[next_bridge->earlier_city];
-      Node *second_node = city_node_map[next_bridge->later_city];
-
-      // Skip the bridge if both connected cities are already in the MST
-      if (first_node->status == 'T' && second_node->status == 'T') {
-        continue;
-      }
-
-      // Select the new vertex to add to the Tree
-      Node *new_node = (first_node->status == 'T') ? second_node : first_node;
-      new_node->status = 'T';
-
-      // Print intermediate information as required by the problem specification
-      cout << min(first_node->city, second_node->city) << " "
-           << max(first_node->city, second_node->city) << endl;
-
-      // For each bridge connected to the new Tree vertex, add it to the
-      // priority queue if the other endpoint is not yet in the Tree
-      for (Bridge *connected_bridge : graph[new_node->city]) {
-        Node *other =
-            (city_node_map[connected_bridge->earlier_city] == new_node)
-                ? city_node_map[connected_bridge->later_city]
-                : city_node_map[connected_bridge->earlier_city];
-        if (other->status == 'U' || other->status == 'F') {
-          bridge_heap.push_back(connected_bridge);
-          push_heap(bridge_heap.begin(), bridge_heap.end(), BridgeComparator{});
-        }
-      }
-      // Add the selected bridge to the MST and update the total maintenance
-      // length
-      mst_bridges.push_back(next_bridge);
-      total_length += next_bridge->road_length;
-    }
-  }
-
-  // Print the total length of bridges to be maintained
-  void printTotalElevationSum() const { cout << total_length << "\n"; }
-
-  // Print information of all bridges to be maintained, with each field
-  // separated by spaces
-  void printAllBridges() {
-    // Sort the cities in lexicographic order
-    sort(mst_bridges.begin(), mst_bridges.end(), bridgeCityOrder);
-
-    for (Bridge *b : mst_bridges) {
-      cout << b->timestamp << " " << b->earlier_city << " " << b->later_city
-           << " " << b->road_length << endl;
-    }
-  }
-
-  // Sort the cities in lexicographic order
-  static bool bridgeCityOrder(Bridge *a, Bridge *b) {
-    if (a->earlier_city != b->earlier_city)
-      return a->earlier_city < b->earlier_city;
-    return a->later_city < b->later_city;
-  }
-
-private:
-  // Store the starting vertex for Prim's algorithm
-  Node *starting_node;
-
-  // Store the list of bridges included in the Minimum Spanning Tree
-  BridgeHeap mst_bridges;
-
-  // Store the total length of all bridges selected for maintenance
-  int total_length;
-};
-
-int main() {
-  std::ios_base::sync_with_stdio(false);
-  std::cin.tie(nullptr);
-  std::cout.tie(nullptr);
-
+// Reads the city and road sections of the text input into 'builder'.
+static void readRoadSections(RoadGraphBuilder &builder) {
   // Input the total number of queries
   int query_count;
   cin >> query_count;
@@ -253,8 +75,8 @@ int main() {
 
     cin >> city >> elevation;
 
-    // Insert each city's elevation into the elevation map
-    city_elevation_map.insert({city, elevation});
+    // Record each city's elevation
+    builder.addCity(city, elevation);
   }
 
   // Input the total number of road entries
@@ -267,42 +89,177 @@ int main() {
 
     cin >> first_city >> second_city >> road_length >> timestamp;
 
-    // Create node entries for the two cities if they haven't been added yet
-    if (city_node_map.find(first_city) == city_node_map.end()) {
-      Node *first_city_node = new Node(first_city);
-      city_node_map.insert({first_city, first_city_node});
+    // Record the road; both cities get an ID if they haven't been seen yet
+    builder.addRoad(first_city, second_city, road_length, timestamp);
+  }
+}
+
+// Prints the command-line usage and returns the error exit code.
+static int printUsage(const char *program) {
+  cerr << "Usage: " << program << " [--eager]\n"
+       << "       " << program << " --kruskal [--threads N]\n"
+       << "       " << program << " --boruvka [--threads N]\n"
+       << "       " << program << " --forest [--threads N]\n"
+       << "       " << program << " --dynamic [--threads N]\n"
+       << "       " << program << " --multi-start [--threads N]\n"
+       << "       " << program << " --convert FILE\n"
+       << "       " << program << " [mode] --graph FILE\n";
+  return 1;
+}
+
+int main(int argc, char **argv) {
+  PrimMode prim_mode = PrimMode::kLazy;
+  bool use_kruskal = false;
+  bool use_boruvka = false;
+  bool use_forest = false;
+  bool use_dynamic = false;
+  bool use_multi_start = false;
+  int thread_count = defaultThreadCount();
+  string graph_path;
+  string convert_path;
+
+  // Parse command-line options.
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--eager") == 0) {
+      prim_mode = PrimMode::kEager;
+    } else if (strcmp(argv[i], "--kruskal") == 0) {
+      use_kruskal = true;
+    } else if (strcmp(argv[i], "--boruvka") == 0) {
+      use_boruvka = true;
+    } else if (strcmp(argv[i], "--forest") == 0) {
+      use_forest = true;
+    } else if (strcmp(argv[i], "--dynamic") == 0) {
+      use_dynamic = true;
+    } else if (strcmp(argv[i], "--multi-start") == 0) {
+      use_multi_start = true;
+    } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+      thread_count = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--graph") == 0 && i + 1 < argc) {
+      graph_path = argv[++i];
+    } else if (strcmp(argv[i], "--convert") == 0 && i + 1 < argc) {
+      convert_path = argv[++i];
+    } else {
+      return printUsage(argv[0]);
+    }
+  }
+
+  std::ios_base::sync_with_stdio(false);
+  std::cin.tie(nullptr);
+  std::cout.tie(nullptr);
+
+  // Hold the whole report in a large buffer that is written out in bulk,
+  // and on every return from main.
+  BulkOutputBuffer output_buffer(cout);
+
+  RoadGraph graph;
+  string query_starting_city;
+  if (!graph_path.empty()) {
+    // Map the binary network; stdin only holds the starting city
+    if (!RoadGraphFile::load(graph_path, graph)) {
+      cerr << "Cannot load road network file: " << graph_path << "\n";
+      return 1;
     }
-    if (city_node_map.find(second_city) == city_node_map.end()) {
-      Node *second_city_node = new Node(second_city);
-      city_node_map.insert({second_city, second_city_node});
+
+    // Input the starting city for Prim's algorithm
+    cin >> query_starting_city;
+  } else {
+    RoadGraphBuilder builder;
+    readRoadSections(builder);
+
+    // Input the starting city for Prim's algorithm
+    cin >> query_starting_city;
+
+    if (!convert_path.empty()) {
+      // The guard messages are stored in the file and printed on load.
+      ostream null_out(nullptr);
+      builder.build(graph, null_out);
+      if (!RoadGraphFile::write(graph, convert_path)) {
+        cerr << "Cannot write road network file: " << convert_path << "\n";
+        return 1;
+      }
+      return 0;
     }
 
-    // Create a bridge connecting the two cities
-    Bridge *new_bridge =
-        new Bridge(first_city, second_city, road_length, timestamp);
+    // Intern the names and lay out the adjacency arrays
+    builder.build(graph);
+  }
 
-    // Add the bridge to the adjacency list for both cities (undirected)
-    graph[first_city].push_back(new_bridge);
-    graph[second_city].push_back(new_bridge);
+  if (use_kruskal) {
+    KruskalMST kruskal(graph);
+    kruskal.setThreadCount(thread_count);
+    kruskal.initializeMST();
+    kruskal.printTotalElevationSum();
+    kruskal.printAllBridges();
+    return 0;
   }
+  if (use_boruvka) {
+    BoruvkaMST boruvka(graph);
+    boruvka.setThreadCount(thread_count);
+    boruvka.initializeMST();
+    boruvka.printTotalElevationSum();
+    boruvka.printAllBridges();
+    return 0;
+  }
+  if (use_forest) {
+    SpanningForest forest(graph);
+    forest.setThreadCount(thread_count);
+    forest.setStartingNode(query_starting_city);
+    forest.initializeForest();
+    forest.printForest();
+    return 0;
+  }
+  if (use_dynamic) {
+    DynamicMST dynamic(graph);
+    dynamic.initializeMST(thread_count);
 
-  // Input the starting city for Prim's algorithm
-  string query_starting_city;
-  cin >> query_starting_city;
+    // Input the new bridges, in the same format as the roads
+    int insertion_count = 0;
+    cin >> insertion_count;
+    while (insertion_count-- > 0) {
+      string first_city, second_city, timestamp;
+      int road_length;
+
+      cin >> first_city >> second_city >> road_length >> timestamp;
+
+      dynamic.addBridge(first_city, second_city, road_length, timestamp);
+      dynamic.printLastInsertion();
+    }
+
+    dynamic.printTotalElevationSum();
+    dynamic.printAllBridges();
+    return 0;
+  }
+  if (use_multi_start) {
+    CachedMST cached(graph);
+    cached.setThreadCount(thread_count);
+    cached.initializeMST();
+    cached.printFromStart(query_starting_city);
+
+    // Input the extra starting cities
+    int start_count = 0;
+    cin >> start_count;
+    while (start_count-- > 0) {
+      string starting_city;
+      cin >> starting_city;
+      cached.printFromStart(starting_city);
+    }
+    return 0;
+  }
 
-  MST *mst = new MST();
+  MST mst(graph);
+  mst.setPrimMode(prim_mode);
 
   // Set the starting city for Prim's algorithm
-  mst->setStartingNode(query_starting_city);
+  mst.setStartingNode(query_starting_city);
 
   // Initialize MST
-  mst->initializeMST();
+  mst.initializeMST();
 
   // Print the total length of the roads to be maintained
-  mst->printTotalElevationSum();
+  mst.printTotalElevationSum();
   // Print information of all roads to be maintained, separating each field with
   // spaces
-  mst->printAllBridges();
+  mst.printAllBridges();
 
   return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,225 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-07-03
+ *
+ * Description: Builds a Minimum Spanning Tree over a RoadGraph using Prim's
+ * algorithm and outputs selected bridges. Vertices are dense city IDs; names
+ * are only looked up when a line is printed. The lazy mode keeps every
+ * candidate bridge in a binary heap; the eager mode keeps only the best
+ * bridge per fringe city in an indexed 4-ary heap with decrease-key. A
+ * starting city with a self-loop is grown lazily in either mode, so that
+ * both print the same guard lines for it. Two distinct roads with identical
+ * fields are the one remaining difference: the modes compare different
+ * pairs, so they may print a different number of guard lines for them,
+ * though every other line matches.
+ */
+#ifndef INHA_ALGORITHM_003_PRIM_MST_HPP
+#define INHA_ALGORITHM_003_PRIM_MST_HPP
+
+#include "indexed_dary_heap.hpp"
+#include "road_graph.hpp"
+#include "spanning_tree.hpp"
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+using namespace std;
+
+// How Prim's algorithm keeps its candidate bridges.
+enum class PrimMode {
+  // Every bridge leaving the tree is pushed; stale ones are skipped on pop.
+  kLazy,
+  // One best bridge per fringe city, updated in place (decrease-key).
+  kEager
+};
+
+// Fringe cities keyed by their best bridge to the tree.
+typedef IndexedDaryHeap<BridgeId, BridgeComparator, 4> FringeHeap;
+
+class MST : public SpanningTree {
+public:
+  explicit MST(const RoadGraph &graph, ostream &out = cout)
+      : SpanningTree(graph, out), owned_status(graph.cityCount(), 'U'),
+        city_status(owned_status), starting_city(kInvalidCity),
+        bridge_order(graph, out), fringe_heap(0, bridge_order),
+        prim_mode(PrimMode::kLazy), peak_heap_size(0) {}
+
+  // Grows the tree with a vertex status array owned by the caller (one char
+  // per city, all 'U' to begin with). Trees over disjoint components may
+  // share one array, even from different threads.
+  MST(const RoadGraph &graph, ostream &out, vector<char> &shared_status)
+      : SpanningTree(graph, out), city_status(shared_status),
+        starting_city(kInvalidCity), bridge_order(graph, out),
+        fringe_heap(0, bridge_order), prim_mode(PrimMode::kLazy),
+        peak_heap_size(0) {}
+
+  // Selects lazy or eager Prim. Must be called before setStartingNode().
+  void setPrimMode(PrimMode mode) { prim_mode = mode; }
+  PrimMode getPrimMode() const { return prim_mode; }
+
+  // Select the starting city for Prim's algorithm
+  void setStartingNode(const string &starting_city_name) {
+    starting_city = graph.findCity(starting_city_name);
+    if (starting_city == kInvalidCity)
+      return;
+    // Update the vertex status to Tree
+    city_status[starting_city] = 'T';
+
+    // The lazy heap takes both copies of a self-loop at the starting city,
+    // and comparing them prints guard lines the eager heap never would.
+    if (prim_mode == PrimMode::kEager && hasSelfLoop(starting_city))
+      prim_mode = PrimMode::kLazy;
+
+    if (prim_mode == PrimMode::kEager) {
+      fringe_heap = FringeHeap(graph.cityCount(), bridge_order);
+      relaxFringe(starting_city);
+      return;
+    }
+
+    // Insert the bridges adjacent to the starting vertex into the priority
+    // queue
+    for (const RoadGraph::Adjacency *entry =
+             graph.adjacencyBegin(starting_city);
+         entry != graph.adjacencyEnd(starting_city); entry++) {
+      pushBridge(entry->bridge);
+    }
+  }
+
+  void initializeMST() {
+    if (prim_mode == PrimMode::kEager) {
+      initializeMSTEager();
+      return;
+    }
+
+    LineWriter writer(out);
+
+    // Repeat until no fringe vertices remain
+    while (!bridge_heap.empty()) {
+      // Get the highest-priority bridge currently at the front of the priority
+      // queue
+      const BridgeId next_bridge = bridge_heap.front();
+      pop_heap(bridge_heap.begin(), bridge_heap.end(), bridge_order);
+      bridge_heap.pop_back();
+
+      const CityId first_city = graph.earlierCity(next_bridge);
+      const CityId second_city = graph.laterCity(next_bridge);
+
+      // Skip the bridge if both connected cities are already in the MST
+      if (city_status[first_city] == 'T' && city_status[second_city] == 'T') {
+        continue;
+      }
+
+      // Select the new vertex to add to the Tree
+      const CityId new_city =
+          (city_status[first_city] == 'T') ? second_city : first_city;
+      city_status[new_city] = 'T';
+
+      // Print intermediate information as required by the problem specification
+      writer.text(graph.cityName(first_city))
+          .character(' ')
+          .text(graph.cityName(second_city))
+          .endLine();
+
+      // For each bridge connected to the new Tree vertex, add it to the
+      // priority queue if the other endpoint is not yet in the Tree
+      for (const RoadGraph::Adjacency *entry = graph.adjacencyBegin(new_city);
+           entry != graph.adjacencyEnd(new_city); entry++) {
+        if (city_status[entry->neighbor] != 'T') {
+          pushBridge(entry->bridge);
+        }
+      }
+      // Add the selected bridge to the MST and update the total maintenance
+      // length
+      addBridge(next_bridge);
+    }
+  }
+
+  // Largest number of candidate bridges held at once.
+  size_t peakHeapSize() const {
+    return (prim_mode == PrimMode::kEager) ? fringe_heap.peakSize()
+                                           : peak_heap_size;
+  }
+
+private:
+  // Pushes a candidate bridge onto the lazy heap.
+  void pushBridge(BridgeId bridge) {
+    bridge_heap.push_back(bridge);
+    push_heap(bridge_heap.begin(), bridge_heap.end(), bridge_order);
+    if (bridge_heap.size() > peak_heap_size)
+      peak_heap_size = bridge_heap.size();
+  }
+
+  // Whether one of the bridges of 'city' leads back to it.
+  bool hasSelfLoop(CityId city) const {
+    for (const RoadGraph::Adjacency *entry = graph.adjacencyBegin(city);
+         entry != graph.adjacencyEnd(city); entry++) {
+      if (entry->neighbor == city)
+        return true;
+    }
+    return false;
+  }
+
+  // Offers every bridge of the new Tree city 'city' to its non-Tree
+  // neighbor, keeping the higher-priority bridge per neighbor.
+  void relaxFringe(CityId city) {
+    for (const RoadGraph::Adjacency *entry = graph.adjacencyBegin(city);
+         entry != graph.adjacencyEnd(city); entry++) {
+      if (city_status[entry->neighbor] != 'T') {
+        fringe_heap.pushOrImprove(entry->neighbor, entry->bridge);
+      }
+    }
+  }
+
+  // Eager Prim: the top fringe city always joins the Tree through its
+  // bridge, which is the highest-priority bridge leaving the Tree, so the
+  // selection order matches the lazy mode.
+  void initializeMSTEager() {
+    LineWriter writer(out);
+    while (!fringe_heap.empty()) {
+      const CityId new_city = fringe_heap.top();
+      const BridgeId next_bridge = fringe_heap.topValue();
+      fringe_heap.pop();
+      city_status[new_city] = 'T';
+
+      // Print intermediate information as required by the problem specification
+      writer.text(graph.cityName(graph.earlierCity(next_bridge)))
+          .character(' ')
+          .text(graph.cityName(graph.laterCity(next_bridge)))
+          .endLine();
+
+      relaxFringe(new_city);
+      addBridge(next_bridge);
+    }
+  }
+
+  // Status array used unless the caller shares one
+  vector<char> owned_status;
+
+  // Track the current status of each vertex: 'U' (Unseen) or 'T' (Tree)
+  vector<char> &city_status;
+
+  // Store the starting vertex for Prim's algorithm
+  CityId starting_city;
+
+  // Priority order of the graph's bridges
+  BridgeComparator bridge_order;
+
+  // Candidate bridge IDs, ordered by BridgeComparator (lazy mode)
+  BridgeHeap bridge_heap;
+
+  // Fringe cities and their best bridge (eager mode)
+  FringeHeap fringe_heap;
+
+  // Selected candidate strategy
+  PrimMode prim_mode;
+
+  // Largest size bridge_heap reached
+  size_t peak_heap_size;
+};
+
+#endif // INHA_ALGORITHM_003_PRIM_MST_HPP
@@ -0,0 +1,116 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-06-23
+ *
+ * Description: Fixed-width 128-bit maintenance priority of a bridge. The
+ * comparator's fields (timestamp rank, length, elevation difference, earlier
+ * and later city rank) are packed most significant first, each only as wide
+ * as the network needs, so one key compare orders two bridges exactly like
+ * the field-by-field comparison.
+ */
+#ifndef INHA_ALGORITHM_003_PRIORITY_KEY_HPP
+#define INHA_ALGORITHM_003_PRIORITY_KEY_HPP
+
+#include <cstdint>
+using namespace std;
+
+// A 128-bit unsigned key; a smaller key means a higher priority.
+struct PriorityKey {
+  uint64_t high;
+  uint64_t low;
+
+  // Shifts the key left by 'width' bits (1 .. 63) and stores 'value' in the
+  // freed low bits.
+  void append(uint64_t value, unsigned width) {
+    high = (high << width) | (low >> (64 - width));
+    low = (low << width) | value;
+  }
+};
+
+inline bool operator==(const PriorityKey &a, const PriorityKey &b) {
+  return a.high == b.high && a.low == b.low;
+}
+inline bool operator!=(const PriorityKey &a, const PriorityKey &b) {
+  return !(a == b);
+}
+inline bool operator<(const PriorityKey &a, const PriorityKey &b) {
+  return (a.high != b.high) ? a.high < b.high : a.low < b.low;
+}
+inline bool operator>(const PriorityKey &a, const PriorityKey &b) {
+  return b < a;
+}
+
+// Bit widths of the packed fields, derived from the value ranges of one
+// network.
+class PriorityKeyLayout {
+public:
+  static constexpr unsigned kKeyBits = 128;
+
+  // Layout for timestamp ranks below 'timestamp_count', lengths in
+  // [min_length, max_length], differences in [min_diff, max_diff] and city
+  // ranks below 'city_count'.
+  PriorityKeyLayout(uint64_t timestamp_count, int64_t min_length,
+                    int64_t max_length, int64_t min_diff, int64_t max_diff,
+                    uint64_t city_count)
+      : min_length(min_length), min_diff(min_diff),
+        timestamp_bits(bitsFor(timestamp_count > 0 ? timestamp_count - 1 : 0)),
+        length_bits(bitsFor(static_cast<uint64_t>(max_length - min_length))),
+        diff_bits(bitsFor(static_cast<uint64_t>(max_diff - min_diff))),
+        city_bits(bitsFor(city_count > 0 ? city_count - 1 : 0)) {}
+
+  // Total width of a key; it can only be packed if this is <= kKeyBits.
+  unsigned totalBits() const {
+    return timestamp_bits + length_bits + diff_bits + 2 * city_bits;
+  }
+  bool fits() const { return totalBits() <= kKeyBits; }
+
+  // Packs one bridge's fields. Requires fits().
+  PriorityKey pack(uint32_t timestamp_rank, int road_length,
+                   int road_length_diff, uint32_t earlier_city,
+                   uint32_t later_city) const {
+    PriorityKey key = {0, 0};
+    appendField(key, timestamp_rank, timestamp_bits);
+    appendField(key, static_cast<uint64_t>(road_length - min_length),
+                length_bits);
+    appendField(key, static_cast<uint64_t>(road_length_diff - min_diff),
+                diff_bits);
+    appendField(key, earlier_city, city_bits);
+    appendField(key, later_city, city_bits);
+    return key;
+  }
+
+  // Number of bits needed to hold every value in [0, max_value].
+  static unsigned bitsFor(uint64_t max_value) {
+    unsigned bits = 0;
+    while (max_value != 0) {
+      bits++;
+      max_value >>= 1;
+    }
+    return bits;
+  }
+
+private:
+  // Appends a field of 'width' bits (0 .. 32); an empty field is skipped.
+  static void appendField(PriorityKey &key, uint64_t value, unsigned width) {
+    if (width != 0)
+      key.append(value, width);
+  }
+
+  // Offsets subtracted so that the smallest length/difference packs as 0.
+  int64_t min_length;
+  int64_t min_diff;
+
+  unsigned timestamp_bits;
+  unsigned length_bits;
+  unsigned diff_bits;
+  unsigned city_bits;
+};
+
+constexpr unsigned PriorityKeyLayout::kKeyBits;
+
+#endif // INHA_ALGORITHM_003_PRIORITY_KEY_HPP
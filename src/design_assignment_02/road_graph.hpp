@@ -0,0 +1,494 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-07-01
+ *
+ * Description: Road network with city names interned to dense integer IDs and
+ * the adjacency stored in compressed sparse row (CSR) arrays. IDs follow the
+ * lexicographic order of the names, so comparing two IDs gives the same
+ * answer as comparing the two names; timestamps are interned the same way.
+ * Bridges are stored as structure-of-arrays columns (packed maintenance
+ * priority, endpoints, length, timestamp) carved from one arena block, and
+ * everything else refers to a bridge by its 32-bit BridgeId. The per-bridge
+ * arrays are read through plain pointers, so they can also live in a mapped
+ * road-network file (see road_graph_file.hpp).
+ */
+#ifndef INHA_ALGORITHM_003_ROAD_GRAPH_HPP
+#define INHA_ALGORITHM_003_ROAD_GRAPH_HPP
+
+#include "priority_key.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+using namespace std;
+
+// Dense ID of a city: its rank among all city names.
+typedef uint32_t CityId;
+
+// Index of a bridge in input order.
+typedef uint32_t BridgeId;
+
+// Dense ID of a timestamp: its rank among all distinct timestamps.
+typedef uint32_t TimestampId;
+
+// Returned by lookups for a name that is not in the network.
+static constexpr CityId kInvalidCity = numeric_limits<CityId>::max();
+
+// Message: Should never happen if logic is correct (guard message).
+static constexpr const char *kUnexpectedErrorMessage =
+    "Algorithm error! You must solve this problem.";
+
+// Every bridge's fields as structure-of-arrays columns, all carved from one
+// arena block and indexed by BridgeId. Comparing priorities walks one dense
+// array instead of chasing a pointer per bridge.
+class BridgeColumns {
+public:
+  // Arena bytes each bridge takes.
+  static constexpr size_t kBytesPerBridge =
+      sizeof(PriorityKey) + 2 * sizeof(CityId) + sizeof(int) +
+      sizeof(TimestampId);
+
+  BridgeColumns()
+      : bridge_count(0), priorities(nullptr), earlier_cities(nullptr),
+        later_cities(nullptr), road_lengths(nullptr), timestamps(nullptr) {}
+
+  // The columns point into the arena, so a copy would share it; moving the
+  // arena keeps its block, so a move is fine.
+  BridgeColumns(const BridgeColumns &) = delete;
+  BridgeColumns &operator=(const BridgeColumns &) = delete;
+  BridgeColumns(BridgeColumns &&) = default;
+  BridgeColumns &operator=(BridgeColumns &&) = default;
+
+  size_t size() const { return bridge_count; }
+
+  // Bytes held by the arena (0 while the columns live in a mapped file).
+  size_t arenaBytes() const { return arena.size() * sizeof(uint64_t); }
+
+  // Start and size of the column block, in the layout allocate() uses.
+  const void *block() const { return priorities; }
+  size_t blockBytes() const { return bridge_count * kBytesPerBridge; }
+
+  // (timestamp, length, difference, earlier, later) packed into one key
+  const PriorityKey *priorityColumn() const { return priorities; }
+
+  // Lexicographically earlier city (the smaller ID)
+  CityId earlierCity(BridgeId bridge) const { return earlier_cities[bridge]; }
+
+  // Lexicographically later city (the larger ID)
+  CityId laterCity(BridgeId bridge) const { return later_cities[bridge]; }
+
+  // Length of the bridge (in meters)
+  int roadLength(BridgeId bridge) const { return road_lengths[bridge]; }
+
+  // Construction timestamp of the bridge, as a rank
+  TimestampId timestamp(BridgeId bridge) const { return timestamps[bridge]; }
+
+private:
+  // Replaces the columns with 'count' uninitialized rows in a fresh arena.
+  // The priority column comes first, so every column stays aligned.
+  void allocate(size_t count) {
+    arena.assign((count * kBytesPerBridge + sizeof(uint64_t) - 1) /
+                     sizeof(uint64_t),
+                 0);
+    char *cursor = reinterpret_cast<char *>(arena.data());
+    priorities = reinterpret_cast<PriorityKey *>(cursor);
+    cursor += count * sizeof(PriorityKey);
+    earlier_cities = reinterpret_cast<CityId *>(cursor);
+    cursor += count * sizeof(CityId);
+    later_cities = reinterpret_cast<CityId *>(cursor);
+    cursor += count * sizeof(CityId);
+    road_lengths = reinterpret_cast<int *>(cursor);
+    cursor += count * sizeof(int);
+    timestamps = reinterpret_cast<TimestampId *>(cursor);
+    bridge_count = count;
+  }
+
+  // Points the columns at 'count' rows laid out as by allocate() in an
+  // external block that outlives them, and frees the arena. The columns are
+  // never written after a graph is built.
+  void attach(const void *block, size_t count) {
+    vector<uint64_t>().swap(arena);
+    char *cursor = static_cast<char *>(const_cast<void *>(block));
+    priorities = reinterpret_cast<PriorityKey *>(cursor);
+    cursor += count * sizeof(PriorityKey);
+    earlier_cities = reinterpret_cast<CityId *>(cursor);
+    cursor += count * sizeof(CityId);
+    later_cities = reinterpret_cast<CityId *>(cursor);
+    cursor += count * sizeof(CityId);
+    road_lengths = reinterpret_cast<int *>(cursor);
+    cursor += count * sizeof(int);
+    timestamps = reinterpret_cast<TimestampId *>(cursor);
+    bridge_count = count;
+  }
+
+  // Backing block of every column
+  vector<uint64_t> arena;
+
+  size_t bridge_count;
+  PriorityKey *priorities;
+  CityId *earlier_cities;
+  CityId *later_cities;
+  int *road_lengths;
+  TimestampId *timestamps;
+
+  friend class RoadGraphBuilder;
+  friend class RoadGraphFile;
+};
+
+constexpr size_t BridgeColumns::kBytesPerBridge;
+
+// Gives each of 'count' bridges a key equal to its rank under the
+// field-by-field order, for networks whose fields do not fit one packed key.
+// fields(id) returns the comparator's fields of bridge 'id' as a tuple.
+// Bridges with equal fields share a rank.
+template <typename Fields>
+void assignRankKeys(size_t count, Fields fields, PriorityKey *keys) {
+  vector<BridgeId> order(count);
+  for (size_t i = 0; i < count; i++)
+    order[i] = static_cast<BridgeId>(i);
+  sort(order.begin(), order.end(),
+       [&](BridgeId a, BridgeId b) { return fields(a) < fields(b); });
+  uint64_t rank = 0;
+  for (size_t i = 0; i < count; i++) {
+    if (i > 0 && fields(order[i - 1]) < fields(order[i]))
+      rank++;
+    keys[order[i]].high = 0;
+    keys[order[i]].low = rank;
+  }
+}
+
+class RoadGraph {
+public:
+  // One CSR entry: the city across a bridge and the bridge itself.
+  struct Adjacency {
+    CityId neighbor;
+    BridgeId bridge;
+  };
+
+  RoadGraph()
+      : offset_data(nullptr), adjacency_data(nullptr), adjacency_count(0),
+        unelevated_road_count(0) {}
+
+  // Number of cities, including cities without any bridge.
+  size_t cityCount() const { return city_names.size(); }
+
+  // Number of bridges.
+  size_t bridgeCount() const { return bridges.size(); }
+
+  // Bytes the bridges take: their columns and their two CSR entries.
+  size_t bridgeBytes() const {
+    return bridges.blockBytes() + adjacency_count * sizeof(Adjacency);
+  }
+
+  // Number of roads with a city the city list gave no elevation; building
+  // the graph printed one guard message for each.
+  size_t unelevatedRoadCount() const { return unelevated_road_count; }
+
+  // Name of city 'city'.
+  const string &cityName(CityId city) const { return city_names[city]; }
+
+  // Number of distinct timestamps.
+  size_t timestampCount() const { return timestamp_names.size(); }
+
+  // Text of timestamp 'timestamp' (format: YYYY-MM).
+  const string &timestampName(TimestampId timestamp) const {
+    return timestamp_names[timestamp];
+  }
+
+  // Elevation of city 'city' (0 if the city list did not give one).
+  int elevation(CityId city) const { return city_elevations[city]; }
+
+  // Returns the ID of 'name', or kInvalidCity if no such city exists.
+  CityId findCity(const string &name) const {
+    vector<string>::const_iterator it =
+        lower_bound(city_names.begin(), city_names.end(), name);
+    if (it == city_names.end() || *it != name)
+      return kInvalidCity;
+    return static_cast<CityId>(it - city_names.begin());
+  }
+
+  // Priority key of 'bridge'; a smaller key means a higher priority.
+  const PriorityKey &priority(BridgeId bridge) const {
+    return bridges.priorityColumn()[bridge];
+  }
+
+  // Priority keys of every bridge, indexed by BridgeId.
+  const PriorityKey *priorities() const { return bridges.priorityColumn(); }
+
+  // Lexicographically earlier (smaller ID) city of 'bridge'.
+  CityId earlierCity(BridgeId bridge) const {
+    return bridges.earlierCity(bridge);
+  }
+
+  // Lexicographically later (larger ID) city of 'bridge'.
+  CityId laterCity(BridgeId bridge) const { return bridges.laterCity(bridge); }
+
+  // Length of 'bridge' (in meters).
+  int roadLength(BridgeId bridge) const { return bridges.roadLength(bridge); }
+
+  // Construction timestamp of 'bridge', as a rank.
+  TimestampId timestamp(BridgeId bridge) const {
+    return bridges.timestamp(bridge);
+  }
+
+  // Absolute elevation difference between the two cities of 'bridge'.
+  int elevationDifference(BridgeId bridge) const {
+    return abs(city_elevations[bridges.earlierCity(bridge)] -
+               city_elevations[bridges.laterCity(bridge)]);
+  }
+
+  // First and one-past-last CSR entries of the bridges incident to 'city', in
+  // input order. A self-loop appears twice, as in the adjacency lists.
+  const Adjacency *adjacencyBegin(CityId city) const {
+    return adjacency_data + offset_data[city];
+  }
+  const Adjacency *adjacencyEnd(CityId city) const {
+    return adjacency_data + offset_data[city + 1];
+  }
+
+  // Number of bridges incident to 'city'.
+  size_t degree(CityId city) const {
+    return offset_data[city + 1] - offset_data[city];
+  }
+
+private:
+  // City names sorted in lexicographic order; the index is the CityId.
+  vector<string> city_names;
+
+  // Elevation of each city, indexed by CityId.
+  vector<int> city_elevations;
+
+  // Distinct timestamps sorted as strings; the index is the TimestampId.
+  vector<string> timestamp_names;
+
+  // Every bridge, indexed by BridgeId.
+  BridgeColumns bridges;
+
+  // adjacency[adjacency_offsets[c] .. adjacency_offsets[c + 1]) are the
+  // bridges of city c. Empty when the CSR arrays live in a mapped file.
+  vector<size_t> adjacency_offsets;
+  vector<Adjacency> adjacency;
+
+  // The CSR arrays as read: the vectors above, or a mapped file
+  const size_t *offset_data;
+  const Adjacency *adjacency_data;
+  size_t adjacency_count;
+
+  // Roads built with a city that had no elevation
+  size_t unelevated_road_count;
+
+  // Keeps a mapped file alive while its arrays are in use
+  shared_ptr<const void> backing_file;
+
+  friend class RoadGraphBuilder;
+  friend class RoadGraphFile;
+};
+
+// Collects the city and road sections of the input, then interns the names
+// and lays out the CSR arrays in one pass.
+class RoadGraphBuilder {
+public:
+  // Records the elevation of 'city'. A repeated city keeps its first value.
+  void addCity(const string &city, int elevation) {
+    CityId id = intern(city);
+    if (!has_elevation[id]) {
+      elevations[id] = elevation;
+      has_elevation[id] = true;
+    }
+  }
+
+  // Records a road between two cities.
+  void addRoad(const string &first_city, const string &second_city,
+               int road_length, const string &timestamp) {
+    PendingRoad road;
+    road.first_city = intern(first_city);
+    road.second_city = intern(second_city);
+    road.road_length = road_length;
+    road.timestamp = internTimestamp(timestamp);
+    roads.push_back(road);
+  }
+
+  // Builds 'graph' from everything added so far. A road whose city has no
+  // elevation prints the guard message to 'error_out'; that city counts as
+  // elevation 0, so the road's difference is |other city's elevation|.
+  void build(RoadGraph &graph, ostream &error_out = cout) {
+    const size_t city_count = names.size();
+
+    // Rank the names: rank[provisional ID] is the final CityId.
+    vector<CityId> order = sortedOrder(names);
+    vector<CityId> rank(city_count);
+    for (size_t i = 0; i < city_count; i++)
+      rank[order[i]] = static_cast<CityId>(i);
+
+    graph.city_names.resize(city_count);
+    graph.city_elevations.resize(city_count);
+    for (size_t i = 0; i < city_count; i++) {
+      graph.city_names[i] = move(names[order[i]]);
+      graph.city_elevations[i] = elevations[order[i]];
+    }
+
+    // Same for the timestamps.
+    vector<TimestampId> timestamp_order = sortedOrder(timestamps);
+    vector<TimestampId> timestamp_rank(timestamps.size());
+    graph.timestamp_names.resize(timestamps.size());
+    for (size_t i = 0; i < timestamps.size(); i++) {
+      timestamp_rank[timestamp_order[i]] = static_cast<TimestampId>(i);
+      graph.timestamp_names[i] = move(timestamps[timestamp_order[i]]);
+    }
+
+    // Bridges, with the earlier and later city resolved by rank.
+    BridgeColumns &columns = graph.bridges;
+    columns.allocate(roads.size());
+    graph.adjacency_offsets.assign(city_count + 1, 0);
+    int64_t min_length = 0, max_length = 0, min_diff = 0, max_diff = 0;
+    graph.unelevated_road_count = 0;
+    for (size_t i = 0; i < roads.size(); i++) {
+      PendingRoad &road = roads[i];
+      if (!has_elevation[road.first_city] ||
+          !has_elevation[road.second_city]) {
+        error_out << kUnexpectedErrorMessage << "\n";
+        graph.unelevated_road_count++;
+      }
+      CityId first = rank[road.first_city];
+      CityId second = rank[road.second_city];
+
+      columns.earlier_cities[i] = min(first, second);
+      columns.later_cities[i] = max(first, second);
+      columns.timestamps[i] = timestamp_rank[road.timestamp];
+      columns.road_lengths[i] = road.road_length;
+      const int road_length_diff = abs(graph.city_elevations[first] -
+                                       graph.city_elevations[second]);
+      if (i == 0 || road.road_length < min_length)
+        min_length = road.road_length;
+      if (i == 0 || road.road_length > max_length)
+        max_length = road.road_length;
+      if (i == 0 || road_length_diff < min_diff)
+        min_diff = road_length_diff;
+      if (i == 0 || road_length_diff > max_diff)
+        max_diff = road_length_diff;
+
+      graph.adjacency_offsets[first + 1]++;
+      graph.adjacency_offsets[second + 1]++;
+    }
+
+    // Priority keys: packed when the fields fit 128 bits, ranks otherwise.
+    PriorityKeyLayout layout(graph.timestamp_names.size(), min_length,
+                             max_length, min_diff, max_diff, city_count);
+    if (layout.fits()) {
+      for (BridgeId id = 0; id < roads.size(); id++) {
+        columns.priorities[id] =
+            layout.pack(columns.timestamps[id], columns.road_lengths[id],
+                        graph.elevationDifference(id),
+                        columns.earlier_cities[id], columns.later_cities[id]);
+      }
+    } else {
+      assignRankKeys(
+          roads.size(),
+          [&graph](BridgeId id) {
+            return make_tuple(graph.timestamp(id), graph.roadLength(id),
+                              graph.elevationDifference(id),
+                              graph.earlierCity(id), graph.laterCity(id));
+          },
+          columns.priorities);
+    }
+
+    // CSR: prefix sums of the degrees, then fill in input order.
+    for (size_t i = 0; i < city_count; i++)
+      graph.adjacency_offsets[i + 1] += graph.adjacency_offsets[i];
+    graph.adjacency.resize(graph.adjacency_offsets[city_count]);
+    vector<size_t> cursor(graph.adjacency_offsets.begin(),
+                          graph.adjacency_offsets.end() - 1);
+    for (size_t i = 0; i < roads.size(); i++) {
+      CityId first = rank[roads[i].first_city];
+      CityId second = rank[roads[i].second_city];
+      RoadGraph::Adjacency &first_entry = graph.adjacency[cursor[first]++];
+      first_entry.neighbor = second;
+      first_entry.bridge = static_cast<BridgeId>(i);
+      RoadGraph::Adjacency &second_entry = graph.adjacency[cursor[second]++];
+      second_entry.neighbor = first;
+      second_entry.bridge = static_cast<BridgeId>(i);
+    }
+    graph.offset_data = graph.adjacency_offsets.data();
+    graph.adjacency_data = graph.adjacency.data();
+    graph.adjacency_count = graph.adjacency.size();
+    graph.backing_file.reset();
+
+    city_ids.clear();
+    names.clear();
+    timestamp_ids.clear();
+    timestamps.clear();
+    elevations.clear();
+    has_elevation.clear();
+    roads.clear();
+  }
+
+private:
+  // A road as read, with provisional (first-seen order) city IDs.
+  struct PendingRoad {
+    CityId first_city;
+    CityId second_city;
+    int road_length;
+    TimestampId timestamp;
+  };
+
+  // Returns the indices of 'values' sorted by value.
+  static vector<uint32_t> sortedOrder(const vector<string> &values) {
+    vector<uint32_t> order(values.size());
+    for (size_t i = 0; i < values.size(); i++)
+      order[i] = static_cast<uint32_t>(i);
+    sort(order.begin(), order.end(), [&values](uint32_t a, uint32_t b) {
+      return values[a] < values[b];
+    });
+    return order;
+  }
+
+  // Returns the provisional ID of 'city', adding it if it is new.
+  CityId intern(const string &city) {
+    pair<unordered_map<string, CityId>::iterator, bool> inserted =
+        city_ids.insert({city, static_cast<CityId>(names.size())});
+    if (inserted.second) {
+      names.push_back(city);
+      elevations.push_back(0);
+      has_elevation.push_back(false);
+    }
+    return inserted.first->second;
+  }
+
+  // Returns the provisional ID of 'timestamp', adding it if it is new.
+  TimestampId internTimestamp(const string &timestamp) {
+    pair<unordered_map<string, TimestampId>::iterator, bool> inserted =
+        timestamp_ids.insert(
+            {timestamp, static_cast<TimestampId>(timestamps.size())});
+    if (inserted.second)
+      timestamps.push_back(timestamp);
+    return inserted.first->second;
+  }
+
+  // Provisional ID of every name seen so far.
+  unordered_map<string, CityId> city_ids;
+
+  // Name, elevation and whether the city list gave one, per provisional ID.
+  vector<string> names;
+  vector<int> elevations;
+  vector<char> has_elevation;
+
+  // Provisional ID and text of every timestamp seen so far.
+  unordered_map<string, TimestampId> timestamp_ids;
+  vector<string> timestamps;
+
+  // Roads in input order.
+  vector<PendingRoad> roads;
+};
+
+#endif // INHA_ALGORITHM_003_ROAD_GRAPH_HPP
@@ -0,0 +1,320 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-07-03
+ *
+ * Description: Binary road-network file. A built RoadGraph is written once;
+ * loading maps the file and points the graph's CSR arrays and bridge columns
+ * straight into the mapping, so nothing is parsed or allocated per bridge.
+ * Only the city and timestamp names are copied out of the string table.
+ * Every ID in the mapped arrays is checked once on load, since the searches
+ * index with them unchecked.
+ *
+ * Layout, in native byte order, every section starting on 8 bytes:
+ *   RoadGraphFileHeader
+ *   city name offsets       uint64[city_count + 1] into the string table
+ *   timestamp name offsets  uint64[timestamp_count + 1] into the table
+ *   string table            sorted city names, then sorted timestamps
+ *   elevations              int32[city_count]
+ *   adjacency offsets       uint64[city_count + 1]
+ *   adjacency               RoadGraph::Adjacency[adjacency_count]
+ *   bridge columns          bridge_count rows in the BridgeColumns layout
+ */
+#ifndef INHA_ALGORITHM_003_ROAD_GRAPH_FILE_HPP
+#define INHA_ALGORITHM_003_ROAD_GRAPH_FILE_HPP
+
+#include "road_graph.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+using namespace std;
+
+static_assert(sizeof(size_t) == sizeof(uint64_t),
+              "adjacency offsets are mapped as 64-bit values");
+
+// Fixed-size start of a road-network file.
+struct RoadGraphFileHeader {
+  // kRoadGraphFileMagic
+  char magic[8];
+
+  uint64_t city_count;
+  uint64_t timestamp_count;
+  uint64_t bridge_count;
+  uint64_t adjacency_count;
+
+  // Bytes of the string table
+  uint64_t string_bytes;
+
+  // Guard messages the text build printed, replayed on every load
+  uint64_t unelevated_road_count;
+};
+
+// Identifies the format and its version.
+static constexpr char kRoadGraphFileMagic[8] = {'I', 'N', 'H', 'A',
+                                                'R', 'G', 'F', '1'};
+
+class RoadGraphFile {
+public:
+  // Writes 'graph' to 'path'. Returns false if the file cannot be written.
+  static bool write(const RoadGraph &graph, const string &path) {
+    RoadGraphFileHeader header;
+    memcpy(header.magic, kRoadGraphFileMagic, sizeof(header.magic));
+    header.city_count = graph.cityCount();
+    header.timestamp_count = graph.timestampCount();
+    header.bridge_count = graph.bridgeCount();
+    header.adjacency_count = graph.adjacency_count;
+    header.unelevated_road_count = graph.unelevated_road_count;
+
+    vector<uint64_t> city_offsets, timestamp_offsets;
+    string strings;
+    appendNames(graph.city_names, city_offsets, strings);
+    appendNames(graph.timestamp_names, timestamp_offsets, strings);
+    header.string_bytes = strings.size();
+
+    FILE *file = fopen(path.c_str(), "wb");
+    if (file == nullptr)
+      return false;
+    size_t written = 0;
+    bool ok = writeSection(file, &header, sizeof(header), written) &&
+              writeSection(file, city_offsets.data(),
+                           city_offsets.size() * sizeof(uint64_t), written) &&
+              writeSection(file, timestamp_offsets.data(),
+                           timestamp_offsets.size() * sizeof(uint64_t),
+                           written) &&
+              writeSection(file, strings.data(), strings.size(), written) &&
+              writeSection(file, graph.city_elevations.data(),
+                           graph.city_elevations.size() * sizeof(int),
+                           written) &&
+              writeSection(file, graph.offset_data,
+                           (graph.cityCount() + 1) * sizeof(size_t),
+                           written) &&
+              writeSection(file, graph.adjacency_data,
+                           graph.adjacency_count *
+                               sizeof(RoadGraph::Adjacency),
+                           written) &&
+              writeSection(file, graph.bridges.block(),
+                           graph.bridges.blockBytes(), written);
+    ok = (fclose(file) == 0) && ok;
+    return ok;
+  }
+
+  // Maps 'path' into 'graph', replacing its contents. The guard message of
+  // every road whose city had no elevation goes to 'error_out', as the text
+  // build prints it. Returns false, leaving 'graph' unchanged, if the file is
+  // missing, truncated, not a road-network file, or holds an out-of-range
+  // ID or unsorted city names.
+  static bool load(const string &path, RoadGraph &graph,
+                   ostream &error_out = cout) {
+    const int descriptor = open(path.c_str(), O_RDONLY);
+    if (descriptor < 0)
+      return false;
+    struct stat status;
+    if (fstat(descriptor, &status) != 0 ||
+        static_cast<size_t>(status.st_size) < sizeof(RoadGraphFileHeader)) {
+      close(descriptor);
+      return false;
+    }
+    const size_t file_bytes = static_cast<size_t>(status.st_size);
+    void *mapping =
+        mmap(nullptr, file_bytes, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    close(descriptor);
+    if (mapping == MAP_FAILED)
+      return false;
+    shared_ptr<const void> backing(mapping, [file_bytes](const void *start) {
+      munmap(const_cast<void *>(start), file_bytes);
+    });
+
+    const char *base = static_cast<const char *>(mapping);
+    RoadGraphFileHeader header;
+    memcpy(&header, base, sizeof(header));
+    if (memcmp(header.magic, kRoadGraphFileMagic, sizeof(header.magic)) != 0)
+      return false;
+
+    // Every count is below the file size, so no section size overflows.
+    if (header.city_count > file_bytes || header.timestamp_count > file_bytes ||
+        header.bridge_count > file_bytes ||
+        header.adjacency_count > file_bytes ||
+        header.string_bytes > file_bytes) {
+      return false;
+    }
+
+    // Section offsets follow from the counts.
+    size_t cursor = sizeof(header);
+    const size_t city_offsets_at =
+        nextSection(cursor, (header.city_count + 1) * sizeof(uint64_t));
+    const size_t timestamp_offsets_at =
+        nextSection(cursor, (header.timestamp_count + 1) * sizeof(uint64_t));
+    const size_t strings_at = nextSection(cursor, header.string_bytes);
+    const size_t elevations_at =
+        nextSection(cursor, header.city_count * sizeof(int));
+    const size_t adjacency_offsets_at =
+        nextSection(cursor, (header.city_count + 1) * sizeof(uint64_t));
+    const size_t adjacency_at = nextSection(
+        cursor, header.adjacency_count * sizeof(RoadGraph::Adjacency));
+    const size_t bridges_at = nextSection(
+        cursor, header.bridge_count * BridgeColumns::kBytesPerBridge);
+    if (cursor > file_bytes)
+      return false;
+
+    const uint64_t *city_offsets =
+        reinterpret_cast<const uint64_t *>(base + city_offsets_at);
+    const uint64_t *timestamp_offsets =
+        reinterpret_cast<const uint64_t *>(base + timestamp_offsets_at);
+    const char *strings = base + strings_at;
+    vector<string> city_names, timestamp_names;
+    if (!readNames(city_offsets, header.city_count, strings,
+                   header.string_bytes, city_names) ||
+        !readNames(timestamp_offsets, header.timestamp_count, strings,
+                   header.string_bytes, timestamp_names)) {
+      return false;
+    }
+
+    // The searches trust the CSR arrays and bridge columns, so check them.
+    const uint64_t *adjacency_offsets =
+        reinterpret_cast<const uint64_t *>(base + adjacency_offsets_at);
+    const RoadGraph::Adjacency *adjacency =
+        reinterpret_cast<const RoadGraph::Adjacency *>(base + adjacency_at);
+    BridgeColumns bridges;
+    bridges.attach(base + bridges_at, header.bridge_count);
+    if (!namesSorted(city_names) ||
+        !adjacencyValid(adjacency_offsets, adjacency, header) ||
+        !bridgesValid(bridges, header) ||
+        header.unelevated_road_count > header.bridge_count) {
+      return false;
+    }
+
+    // The file is valid; only now is 'graph' replaced.
+    graph.city_names.swap(city_names);
+    graph.timestamp_names.swap(timestamp_names);
+
+    const int *elevations =
+        reinterpret_cast<const int *>(base + elevations_at);
+    graph.city_elevations.assign(elevations, elevations + header.city_count);
+
+    vector<size_t>().swap(graph.adjacency_offsets);
+    vector<RoadGraph::Adjacency>().swap(graph.adjacency);
+    graph.offset_data = reinterpret_cast<const size_t *>(adjacency_offsets);
+    graph.adjacency_data = adjacency;
+    graph.adjacency_count = header.adjacency_count;
+    graph.bridges = move(bridges);
+    graph.unelevated_road_count = header.unelevated_road_count;
+    graph.backing_file = backing;
+
+    for (uint64_t i = 0; i < header.unelevated_road_count; i++)
+      error_out << kUnexpectedErrorMessage << "\n";
+    return true;
+  }
+
+private:
+  // Sections start on 8 bytes so that every array in them is aligned.
+  static size_t alignSection(size_t offset) {
+    return (offset + 7) & ~static_cast<size_t>(7);
+  }
+
+  // Returns where a section of 'bytes' starting at 'cursor' begins, and moves
+  // 'cursor' past it.
+  static size_t nextSection(size_t &cursor, size_t bytes) {
+    const size_t start = alignSection(cursor);
+    cursor = start + bytes;
+    return start;
+  }
+
+  // Writes one section, padded with zeros to the next 8-byte boundary.
+  static bool writeSection(FILE *file, const void *data, size_t bytes,
+                           size_t &written) {
+    static const char kPadding[8] = {0};
+    const size_t padding = alignSection(written) - written;
+    if (padding > 0 && fwrite(kPadding, 1, padding, file) != padding)
+      return false;
+    if (bytes > 0 && fwrite(data, 1, bytes, file) != bytes)
+      return false;
+    written += padding + bytes;
+    return true;
+  }
+
+  // Appends 'names' to 'strings', recording where each one starts and where
+  // the last one ends.
+  static void appendNames(const vector<string> &names,
+                          vector<uint64_t> &offsets, string &strings) {
+    offsets.clear();
+    for (const string &name : names) {
+      offsets.push_back(strings.size());
+      strings += name;
+    }
+    offsets.push_back(strings.size());
+  }
+
+  // Copies 'count' names out of the string table. Returns false if an
+  // offset points outside it.
+  static bool readNames(const uint64_t *offsets, uint64_t count,
+                        const char *strings, uint64_t string_bytes,
+                        vector<string> &names) {
+    names.clear();
+    names.reserve(count);
+    for (uint64_t i = 0; i < count; i++) {
+      if (offsets[i] > offsets[i + 1] || offsets[i + 1] > string_bytes)
+        return false;
+      names.emplace_back(strings + offsets[i], offsets[i + 1] - offsets[i]);
+    }
+    return true;
+  }
+
+  // Whether every name is strictly after the one before, as findCity()
+  // needs for its binary search.
+  static bool namesSorted(const vector<string> &names) {
+    for (size_t i = 1; i < names.size(); i++) {
+      if (!(names[i - 1] < names[i]))
+        return false;
+    }
+    return true;
+  }
+
+  // Whether the CSR offsets start at 0, never decrease and end at
+  // adjacency_count, and every entry names a city and a bridge that exist.
+  static bool adjacencyValid(const uint64_t *offsets,
+                             const RoadGraph::Adjacency *adjacency,
+                             const RoadGraphFileHeader &header) {
+    if (offsets[0] != 0 ||
+        offsets[header.city_count] != header.adjacency_count)
+      return false;
+    for (uint64_t city = 0; city < header.city_count; city++) {
+      if (offsets[city] > offsets[city + 1])
+        return false;
+    }
+    for (uint64_t i = 0; i < header.adjacency_count; i++) {
+      if (adjacency[i].neighbor >= header.city_count ||
+          adjacency[i].bridge >= header.bridge_count)
+        return false;
+    }
+    return true;
+  }
+
+  // Whether every bridge joins two cities that exist and was built at a
+  // timestamp that exists.
+  static bool bridgesValid(const BridgeColumns &bridges,
+                           const RoadGraphFileHeader &header) {
+    for (uint64_t i = 0; i < header.bridge_count; i++) {
+      const BridgeId bridge = static_cast<BridgeId>(i);
+      if (bridges.earlierCity(bridge) >= header.city_count ||
+          bridges.laterCity(bridge) >= header.city_count ||
+          bridges.timestamp(bridge) >= header.timestamp_count)
+        return false;
+    }
+    return true;
+  }
+};
+
+#endif // INHA_ALGORITHM_003_ROAD_GRAPH_FILE_HPP
@@ -0,0 +1,152 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-07-03
+ *
+ * Description: What-if evaluation of many variants of one road network. A
+ * scenario closes bridges of the base network, adds roads, and may set or
+ * change city elevations. Each scenario builds its own RoadGraph and runs
+ * its own MST, sharing nothing mutable with other scenarios, so a thread
+ * pool evaluates a batch in parallel. Every scenario's report is exactly
+ * what the program prints for its network read from a file, guard messages
+ * included: the build and the tree's bridge order write them to the report,
+ * never to the process-wide cout.
+ */
+#ifndef INHA_ALGORITHM_003_ROAD_SCENARIOS_HPP
+#define INHA_ALGORITHM_003_ROAD_SCENARIOS_HPP
+
+#include "../design_assignment_01/work_stealing_pool.hpp"
+#include "prim_mst.hpp"
+#include "road_graph.hpp"
+#include "spanning_tree.hpp"
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+using namespace std;
+
+// A road given by city names, as in the input file.
+struct ScenarioRoad {
+  string first_city;
+  string second_city;
+  int road_length;
+  string timestamp;
+};
+
+// One what-if variant of the base network.
+struct RoadScenario {
+  // City Prim starts from
+  string starting_city;
+
+  // Base bridges that are closed in this scenario
+  vector<BridgeId> closed_bridges;
+
+  // Roads that exist only in this scenario
+  vector<ScenarioRoad> added_roads;
+
+  // Elevations that replace the base value, or give one to a new city
+  vector<pair<string, int>> city_elevations;
+};
+
+// Outcome of one scenario.
+struct ScenarioResult {
+  // Total length of the scenario's tree
+  long long total_length;
+
+  // Number of bridges in the scenario's tree
+  size_t bridge_count;
+
+  // Discovery lines, total and bridge list, as the program prints them
+  string report;
+};
+
+class ScenarioBatch {
+public:
+  explicit ScenarioBatch(const RoadGraph &base)
+      : base(base), thread_count(defaultThreadCount()),
+        prim_mode(PrimMode::kLazy) {}
+
+  // Number of pool threads evaluating scenarios.
+  void setThreadCount(int count) { thread_count = (count < 1) ? 1 : count; }
+  int getThreadCount() const { return thread_count; }
+
+  // Prim mode every scenario runs with.
+  void setPrimMode(PrimMode mode) { prim_mode = mode; }
+  PrimMode getPrimMode() const { return prim_mode; }
+
+  // Evaluates every scenario; results are in scenario order.
+  vector<ScenarioResult> run(const vector<RoadScenario> &scenarios) const {
+    vector<ScenarioResult> results(scenarios.size());
+    WorkStealingPool pool(thread_count);
+    for (size_t i = 0; i < scenarios.size(); i++) {
+      pool.submit([this, &scenarios, &results, i](int) {
+        results[i] = evaluate(scenarios[i]);
+      });
+    }
+    pool.wait();
+    return results;
+  }
+
+  // Evaluates one scenario on the calling thread.
+  ScenarioResult evaluate(const RoadScenario &scenario) const {
+    ostringstream report;
+    RoadGraph graph;
+    buildScenarioGraph(scenario, graph, report);
+
+    MST mst(graph, report);
+    mst.setPrimMode(prim_mode);
+    mst.setStartingNode(scenario.starting_city);
+    mst.initializeMST();
+    mst.printTotalElevationSum();
+    mst.printAllBridges();
+    return ScenarioResult{mst.totalLength(), mst.bridges().size(),
+                          report.str()};
+  }
+
+private:
+  // Builds the scenario's own network. Guard messages of the build go to
+  // 'error_out', ahead of the tree, as when the network is read from stdin.
+  void buildScenarioGraph(const RoadScenario &scenario, RoadGraph &graph,
+                          ostream &error_out) const {
+    RoadGraphBuilder builder;
+
+    // A city keeps its first elevation, so the scenario's values go first.
+    for (const pair<string, int> &city : scenario.city_elevations)
+      builder.addCity(city.first, city.second);
+    for (CityId city = 0; city < base.cityCount(); city++)
+      builder.addCity(base.cityName(city), base.elevation(city));
+
+    vector<char> closed(base.bridgeCount(), 0);
+    for (BridgeId id : scenario.closed_bridges) {
+      if (id < closed.size())
+        closed[id] = 1;
+    }
+    for (BridgeId id = 0; id < base.bridgeCount(); id++) {
+      if (closed[id])
+        continue;
+      builder.addRoad(base.cityName(base.earlierCity(id)),
+                      base.cityName(base.laterCity(id)), base.roadLength(id),
+                      base.timestampName(base.timestamp(id)));
+    }
+    for (const ScenarioRoad &road : scenario.added_roads)
+      builder.addRoad(road.first_city, road.second_city, road.road_length,
+                      road.timestamp);
+    builder.build(graph, error_out);
+  }
+
+  // Network every scenario starts from
+  const RoadGraph &base;
+
+  // Number of pool threads evaluating scenarios
+  int thread_count;
+
+  // Prim mode every scenario runs with
+  PrimMode prim_mode;
+};
+
+#endif // INHA_ALGORITHM_003_ROAD_SCENARIOS_HPP
@@ -0,0 +1,193 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-06-30
+ *
+ * Description: Minimum spanning forest over a possibly disconnected network.
+ * One union-find pass labels the connected components (cities without any
+ * bridge are not part of the network). Then a thread pool grows each
+ * component's tree with Prim's algorithm, from the requested starting city
+ * for its component and from the lexicographically smallest city for every
+ * other component. Each tree writes to its own buffer, and the buffers are
+ * printed in component order.
+ */
+#ifndef INHA_ALGORITHM_003_SPANNING_FOREST_HPP
+#define INHA_ALGORITHM_003_SPANNING_FOREST_HPP
+
+#include "../design_assignment_01/work_stealing_pool.hpp"
+#include "prim_mst.hpp"
+#include "road_graph.hpp"
+#include "spanning_tree.hpp"
+#include "union_find.hpp"
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+using namespace std;
+
+// One connected component and the report of its tree.
+struct ForestComponent {
+  // City Prim starts from
+  CityId starting_city;
+
+  // Number of cities in the component
+  size_t city_count;
+
+  // Number of CSR entries of its cities, the work estimate for scheduling
+  size_t adjacency_count;
+
+  // Total length of the component's tree
+  long long total_length;
+
+  // Discovery lines, total and bridge list, exactly as a single-tree run
+  // from 'starting_city' prints them
+  string report;
+};
+
+class SpanningForest {
+public:
+  explicit SpanningForest(const RoadGraph &graph, ostream &out = cout)
+      : graph(graph), out(out), requested_city(kInvalidCity),
+        thread_count(defaultThreadCount()) {}
+
+  // Number of pool threads growing trees.
+  void setThreadCount(int count) { thread_count = (count < 1) ? 1 : count; }
+  int getThreadCount() const { return thread_count; }
+
+  // Select the starting city of its own component. That component is
+  // reported first.
+  void setStartingNode(const string &starting_city_name) {
+    requested_city = graph.findCity(starting_city_name);
+  }
+
+  // Labels the components and grows every component's tree.
+  void initializeForest() {
+    labelComponents();
+
+    // Largest components first, several small ones per task, so that the
+    // pool stays busy until the end.
+    vector<size_t> order(components.size());
+    for (size_t i = 0; i < order.size(); i++)
+      order[i] = i;
+    sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+      return components[a].adjacency_count > components[b].adjacency_count;
+    });
+
+    vector<char> city_status(graph.cityCount(), 'U');
+    {
+      WorkStealingPool pool(thread_count);
+      size_t batch_begin = 0;
+      size_t batch_work = 0;
+      for (size_t i = 0; i < order.size(); i++) {
+        batch_work += components[order[i]].adjacency_count + 1;
+        if (batch_work < kMinTaskWork && i + 1 < order.size())
+          continue;
+        pool.submit([this, &order, &city_status, batch_begin, i](int) {
+          for (size_t j = batch_begin; j <= i; j++)
+            growTree(components[order[j]], city_status);
+        });
+        batch_begin = i + 1;
+        batch_work = 0;
+      }
+      pool.wait();
+    }
+  }
+
+  // Prints the number of components, then for each component a
+  // "<starting city> <city count>" line followed by its tree's discovery
+  // lines, total and bridge list.
+  void printForest() const {
+    out << components.size() << "\n";
+    for (const ForestComponent &component : components) {
+      out << graph.cityName(component.starting_city) << " "
+          << component.city_count << "\n";
+      out << component.report;
+    }
+    out.flush();
+  }
+
+  // Components in report order.
+  const vector<ForestComponent> &getComponents() const { return components; }
+
+  // Sum of every component's total.
+  long long totalLength() const {
+    long long total = 0;
+    for (const ForestComponent &component : components)
+      total += component.total_length;
+    return total;
+  }
+
+private:
+  // Components adding up to fewer CSR entries than this share a task.
+  static constexpr size_t kMinTaskWork = 1 << 14;
+
+  // Finds the components with one union-find pass and orders them: the
+  // requested city's component first, then by smallest city name.
+  void labelComponents() {
+    DisjointSet sets(graph.cityCount());
+    for (BridgeId id = 0; id < graph.bridgeCount(); id++) {
+      sets.unite(graph.earlierCity(id), graph.laterCity(id));
+    }
+
+    // Cities are visited in ID (name) order, so a component's first city
+    // is its smallest one.
+    const size_t kUnlabeled = static_cast<size_t>(-1);
+    vector<size_t> root_component(graph.cityCount(), kUnlabeled);
+    components.clear();
+    for (CityId city = 0; city < graph.cityCount(); city++) {
+      if (graph.degree(city) == 0)
+        continue;
+      size_t &label = root_component[sets.find(city)];
+      if (label == kUnlabeled) {
+        label = components.size();
+        components.push_back(ForestComponent{city, 0, 0, 0, string()});
+      }
+      components[label].city_count++;
+      components[label].adjacency_count += graph.degree(city);
+    }
+
+    if (requested_city != kInvalidCity && graph.degree(requested_city) > 0) {
+      const size_t label = root_component[sets.find(requested_city)];
+      components[label].starting_city = requested_city;
+      rotate(components.begin(), components.begin() + label,
+             components.begin() + label + 1);
+    }
+  }
+
+  // Runs Prim over one component; components never share a city, so the
+  // trees can share one status array.
+  void growTree(ForestComponent &component, vector<char> &city_status) const {
+    ostringstream report;
+    MST tree(graph, report, city_status);
+    tree.setStartingNode(graph.cityName(component.starting_city));
+    tree.initializeMST();
+    tree.printTotalElevationSum();
+    tree.printAllBridges();
+    component.total_length = tree.totalLength();
+    component.report = report.str();
+  }
+
+  // Graph the forest is built over
+  const RoadGraph &graph;
+
+  // Destination of the report
+  ostream &out;
+
+  // City given to setStartingNode(), if it exists
+  CityId requested_city;
+
+  // Number of pool threads growing trees
+  int thread_count;
+
+  // Components in report order
+  vector<ForestComponent> components;
+};
+
+constexpr size_t SpanningForest::kMinTaskWork;
+
+#endif // INHA_ALGORITHM_003_SPANNING_FOREST_HPP
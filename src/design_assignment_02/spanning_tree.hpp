@@ -0,0 +1,125 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-07-03
+ *
+ * Description: Bridge priority order and the selected-bridge report shared by
+ * every MST engine. An engine adds bridges as it selects them; the total and
+ * the bridge list are printed the same way whichever engine ran.
+ */
+#ifndef INHA_ALGORITHM_003_SPANNING_TREE_HPP
+#define INHA_ALGORITHM_003_SPANNING_TREE_HPP
+
+#include "output_buffer.hpp"
+#include "road_graph.hpp"
+#include <algorithm>
+#include <iostream>
+#include <thread>
+#include <vector>
+using namespace std;
+
+// Store a collection of 32-bit bridge IDs used as a heap or list
+typedef vector<BridgeId> BridgeHeap;
+
+// Define a comparator struct that determines the maintenance priority of
+// bridges (roads): timestamp, length, elevation difference, then the earlier
+// and later city name. All five are packed into the bridge's priority key,
+// so one load from the graph's key column per bridge decides. Two bridges
+// with the same key print the guard message to 'out', the stream of the tree
+// being grown, so it stays in that tree's report.
+struct BridgeComparator {
+  BridgeComparator(const RoadGraph &graph, ostream &out)
+      : priorities(graph.priorities()), out(&out) {}
+
+  bool operator()(BridgeId a, BridgeId b) const {
+    const PriorityKey &a_priority = priorities[a];
+    const PriorityKey &b_priority = priorities[b];
+    if (a_priority != b_priority)
+      return a_priority > b_priority;
+
+    *out << kUnexpectedErrorMessage << "\n";
+    return false;
+  }
+
+  // Priority key column of the graph
+  const PriorityKey *priorities;
+
+  // Stream the guard message goes to
+  ostream *out;
+};
+
+// Number of hardware threads, at least 1; the default for parallel engines.
+inline int defaultThreadCount() {
+  unsigned count = thread::hardware_concurrency();
+  return (count == 0) ? 1 : static_cast<int>(count);
+}
+
+class SpanningTree {
+public:
+  SpanningTree(const RoadGraph &graph, ostream &out)
+      : graph(graph), out(out), total_length(0) {}
+
+  // Print the total length of bridges to be maintained
+  void printTotalElevationSum() const {
+    LineWriter(out).integer(total_length).endLine();
+  }
+
+  // Print information of all bridges to be maintained, with each field
+  // separated by spaces
+  void printAllBridges() {
+    // Sort the cities in lexicographic order
+    sort(mst_bridges.begin(), mst_bridges.end(),
+         [this](BridgeId a, BridgeId b) { return bridgeCityOrder(a, b); });
+
+    LineWriter writer(out);
+    for (BridgeId b : mst_bridges) {
+      writer.text(graph.timestampName(graph.timestamp(b)))
+          .character(' ')
+          .text(graph.cityName(graph.earlierCity(b)))
+          .character(' ')
+          .text(graph.cityName(graph.laterCity(b)))
+          .character(' ')
+          .integer(graph.roadLength(b))
+          .endLine();
+    }
+  }
+
+  // Sort the cities in lexicographic order
+  bool bridgeCityOrder(BridgeId a, BridgeId b) const {
+    if (graph.earlierCity(a) != graph.earlierCity(b))
+      return graph.earlierCity(a) < graph.earlierCity(b);
+    return graph.laterCity(a) < graph.laterCity(b);
+  }
+
+  // Total length of the bridges selected so far.
+  long long totalLength() const { return total_length; }
+
+  // Bridges selected so far, in selection order until printAllBridges().
+  const BridgeHeap &bridges() const { return mst_bridges; }
+
+protected:
+  // Add the selected bridge to the MST and update the total maintenance
+  // length
+  void addBridge(BridgeId bridge) {
+    mst_bridges.push_back(bridge);
+    total_length += graph.roadLength(bridge);
+  }
+
+  // Graph the tree is built over
+  const RoadGraph &graph;
+
+  // Destination of every printed line
+  ostream &out;
+
+  // Store the list of bridges included in the Minimum Spanning Tree
+  BridgeHeap mst_bridges;
+
+  // Store the total length of all bridges selected for maintenance
+  long long total_length;
+};
+
+#endif // INHA_ALGORITHM_003_SPANNING_TREE_HPP
@@ -0,0 +1,126 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-06-25
+ *
+ * Description: Disjoint-set forests over the dense IDs 0 .. size-1: a
+ * sequential one with path compression and union by rank, and a lock-free
+ * one for concurrent finds and unions, which halves paths with CAS and links
+ * the larger root under the smaller so no cycle can form.
+ */
+#ifndef INHA_ALGORITHM_003_UNION_FIND_HPP
+#define INHA_ALGORITHM_003_UNION_FIND_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+using namespace std;
+
+class DisjointSet {
+public:
+  explicit DisjointSet(size_t count) : parents(count), ranks(count, 0) {
+    for (size_t i = 0; i < count; i++)
+      parents[i] = static_cast<uint32_t>(i);
+  }
+
+  size_t size() const { return parents.size(); }
+
+  // Returns the representative of the set holding 'id', pointing every ID
+  // on the way straight at it.
+  uint32_t find(uint32_t id) {
+    uint32_t root = id;
+    while (parents[root] != root)
+      root = parents[root];
+    while (parents[id] != root) {
+      uint32_t next = parents[id];
+      parents[id] = root;
+      id = next;
+    }
+    return root;
+  }
+
+  // Merges the sets holding 'a' and 'b'. Returns false if they were already
+  // the same set.
+  bool unite(uint32_t a, uint32_t b) {
+    a = find(a);
+    b = find(b);
+    if (a == b)
+      return false;
+    if (ranks[a] < ranks[b]) {
+      parents[a] = b;
+    } else {
+      parents[b] = a;
+      if (ranks[a] == ranks[b])
+        ranks[a]++;
+    }
+    return true;
+  }
+
+private:
+  // Parent of each ID; a root is its own parent.
+  vector<uint32_t> parents;
+
+  // Upper bound on the height of each root's tree.
+  vector<uint8_t> ranks;
+};
+
+class ConcurrentDisjointSet {
+public:
+  explicit ConcurrentDisjointSet(size_t count) : parents(count) {
+    for (size_t i = 0; i < count; i++)
+      parents[i].store(static_cast<uint32_t>(i), memory_order_relaxed);
+  }
+
+  ConcurrentDisjointSet(const ConcurrentDisjointSet &) = delete;
+  ConcurrentDisjointSet &operator=(const ConcurrentDisjointSet &) = delete;
+
+  size_t size() const { return parents.size(); }
+
+  // Returns the current representative of the set holding 'id'. Safe to call
+  // while other threads unite.
+  uint32_t find(uint32_t id) {
+    while (true) {
+      uint32_t parent = parents[id].load(memory_order_acquire);
+      if (parent == id)
+        return id;
+      uint32_t grandparent = parents[parent].load(memory_order_acquire);
+      if (grandparent == parent)
+        return parent;
+      // Path halving; losing the race only skips the shortcut.
+      parents[id].compare_exchange_weak(parent, grandparent,
+                                        memory_order_release,
+                                        memory_order_relaxed);
+      id = grandparent;
+    }
+  }
+
+  // Merges the sets holding 'a' and 'b'. Returns false if they were already
+  // the same set; of several threads uniting the same two sets, exactly one
+  // returns true.
+  bool unite(uint32_t a, uint32_t b) {
+    while (true) {
+      a = find(a);
+      b = find(b);
+      if (a == b)
+        return false;
+      if (a > b)
+        swap(a, b);
+      uint32_t expected = b;
+      if (parents[b].compare_exchange_strong(expected, a,
+                                             memory_order_acq_rel))
+        return true;
+    }
+  }
+
+private:
+  // Parent of each ID; a root is its own parent.
+  vector<atomic<uint32_t>> parents;
+};
+
+#endif // INHA_ALGORITHM_003_UNION_FIND_HPP
@@ -0,0 +1,244 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-06-20
+ */
+#include "../../src/design_assignment_01/basic_red_black_tree.hpp"
+#include "../../src/design_assignment_01/inline_subject_key.hpp"
+#include <gtest/gtest.h>
+#include <random>
+#include <set>
+
+typedef BasicRedBlackTree<int, int, IntKeyComparator> IntTree;
+typedef BasicRedBlackTree<pair<int, string>, int, NodeKeyComparator>
+    CompositeTree;
+
+// Returns the black height of the subtree, or -1 if an invariant is broken.
+template <typename Node> int blackHeight(const Node *node) {
+  if (node == nullptr)
+    return 1;
+  if (node->getColor() == 'R' &&
+      ((node->getLeftChild() && node->getLeftChild()->getColor() == 'R') ||
+       (node->getRightChild() && node->getRightChild()->getColor() == 'R')))
+    return -1;
+  int left = blackHeight(node->getLeftChild());
+  int right = blackHeight(node->getRightChild());
+  if (left < 0 || left != right)
+    return -1;
+  return left + (node->getColor() == 'B');
+}
+
+TEST(RBTEngine, IntComparator) {
+  EXPECT_EQ(IntKeyComparator::compare(1, 2), kCompareLess);
+  EXPECT_EQ(IntKeyComparator::compare(2, 2), kCompareEqual);
+  EXPECT_EQ(IntKeyComparator::compare(3, 2), kCompareGreater);
+}
+
+TEST(RBTEngine, CompositeComparator) {
+  EXPECT_EQ(NodeKeyComparator::compare({12210795, "Misaso"},
+                                       {12210795, "Algorithm"}),
+            kCompareGreater);
+  EXPECT_EQ(NodeKeyComparator::compare({12200795, "Misaso"},
+                                       {12210795, "Algorithm"}),
+            kCompareLess);
+  EXPECT_EQ(NodeKeyComparator::compare({1, "A"}, {1, "A"}), kCompareEqual);
+}
+
+TEST(RBTEngine, AscendingInsertKeepsInvariants) {
+  IntTree tree;
+  for (int i = 0; i < 1000; i++) {
+    IntTree::InsertResult result = tree.insert(i, i * 2);
+    EXPECT_EQ(result.second, IntTree::kIsNewlyInserted);
+  }
+  EXPECT_EQ(tree.size(), 1000);
+  EXPECT_EQ(tree.root()->getColor(), 'B');
+  EXPECT_GT(blackHeight(tree.root()), 0);
+  for (int i = 0; i < 1000; i++) {
+    ASSERT_NE(tree.find(i), nullptr);
+    EXPECT_EQ(tree.find(i)->getValue(), i * 2);
+  }
+  EXPECT_EQ(tree.find(1000), nullptr);
+}
+
+TEST(RBTEngine, DuplicateKeepsPayload) {
+  CompositeTree tree;
+  tree.insert({12201234, "Algorithms"}, 10204);
+  tree.insert({12221622, "Algorithms"}, 15104);
+  CompositeTree::InsertResult result = tree.insert({12201234, "Algorithms"}, 7);
+  EXPECT_EQ(result.second, CompositeTree::kIsDuplicateNode);
+  EXPECT_EQ(result.first->getValue(), 10204);
+  EXPECT_EQ(tree.size(), 2);
+}
+
+// Same insertion order as docs/sample-P1.1.in: depths must match the sample.
+TEST(RBTEngine, SampleDepths) {
+  CompositeTree tree;
+  const pair<int, string> keys[] = {
+      {12201234, "Algorithms"}, {12221622, "Algorithms"},
+      {12201234, "Misaso"},     {12211748, "Algorithms"},
+      {12243343, "Misaso"},     {12215201, "Mathmatics"}};
+  const int expected_depths[] = {0, 1, 0, 2, 2, 3};
+  for (int i = 0; i < 6; i++) {
+    CompositeTree::InsertResult result = tree.insert(keys[i], i);
+    EXPECT_EQ(CompositeTree::getNodeDepth(result.first), expected_depths[i]);
+  }
+  EXPECT_GT(blackHeight(tree.root()), 0);
+}
+
+TEST(RBTEngine, EraseKeepsInvariantsAndOrder) {
+  IntTree tree;
+  for (int i = 0; i < 512; i++)
+    tree.insert((i * 37) % 512, i);
+  // Erase every key that is not a multiple of three, in scrambled order.
+  for (int i = 0; i < 512; i++) {
+    const int key = (i * 101) % 512;
+    if (key % 3 != 0) {
+      tree.erase(tree.find(key));
+      ASSERT_GT(blackHeight(tree.root()), 0);
+    }
+  }
+  EXPECT_EQ(tree.size(), 171);
+  int expected = 0;
+  for (IntTree::Node *node = tree.first(); node != nullptr;
+       node = IntTree::successor(node)) {
+    EXPECT_EQ(node->getKey(), expected);
+    expected += 3;
+  }
+  EXPECT_EQ(tree.lowerBound(4)->getKey(), 6);
+  EXPECT_EQ(tree.lowerBound(511), nullptr);
+}
+
+// Checks InlineSubject<Width> against std::string::compare on names that
+// straddle the inline width and share long prefixes.
+template <size_t Width> void expectInlineSubjectOrder() {
+  vector<string> names = {"",          "A",          "Algo",      "Algorithms",
+                          "Math",      "Mathmatics", "Misaso",    "Zoo",
+                          "\x7f",      "\xff\x01"};
+  for (size_t length : {Width - 1, Width, Width + 1, Width + 9}) {
+    names.push_back(string(length, 'm'));
+    names.push_back(string(length, 'm') + "a");
+    names.push_back(string(length - 1, 'm') + "z");
+  }
+  for (const string &a : names) {
+    EXPECT_EQ(InlineSubject<Width>(a).toString(), a);
+    EXPECT_EQ(InlineSubject<Width>(a).isInline(), a.size() <= Width);
+    for (const string &b : names) {
+      const int result = a.compare(b);
+      EXPECT_EQ(InlineSubject<Width>::compare(InlineSubject<Width>(a),
+                                              InlineSubject<Width>(b)),
+                (result > 0) - (result < 0))
+          << a << " vs " << b;
+    }
+  }
+}
+
+TEST(RBTEngine, InlineSubjectMatchesStringOrder) {
+  expectInlineSubjectOrder<16>();
+  expectInlineSubjectOrder<32>();
+  EXPECT_EQ(InlineNodeKeyComparator<16>::compare(
+                {12210795, InlineSubject<16>("Misaso")},
+                {12210795, InlineSubject<16>("Algorithm")}),
+            kCompareGreater);
+  EXPECT_EQ(InlineNodeKeyComparator<16>::compare(
+                {12200795, InlineSubject<16>("Misaso")},
+                {12210795, InlineSubject<16>("Algorithm")}),
+            kCompareLess);
+}
+
+TEST(RBTEngine, BatchedLookupsMatchSingleLookups) {
+  IntTree tree;
+  for (int i = 0; i < 3000; i++)
+    tree.insert((i * 7919) % 6000, i);
+
+  // More keys than lanes, with hits, misses and keys past the maximum.
+  vector<int> keys;
+  for (int key = -3; key < 6010; key += 3)
+    keys.push_back(key);
+  vector<IntTree::Node *> lower_bounds(keys.size());
+  vector<IntTree::Node *> found(keys.size());
+  tree.lowerBoundBatch(keys.data(), keys.size(), lower_bounds.data());
+  tree.findBatch(keys.data(), keys.size(), found.data());
+  for (size_t i = 0; i < keys.size(); i++) {
+    EXPECT_EQ(lower_bounds[i], tree.lowerBound(keys[i]));
+    EXPECT_EQ(found[i], tree.find(keys[i]));
+  }
+
+  IntTree empty_tree;
+  empty_tree.lowerBoundBatch(keys.data(), 3, lower_bounds.data());
+  EXPECT_EQ(lower_bounds[0], nullptr);
+}
+
+// Returns whether every child of the subtree points back at its parent.
+template <typename Node> bool parentLinksValid(const Node *node) {
+  if (node == nullptr)
+    return true;
+  for (const Node *child : {node->getLeftChild(), node->getRightChild()}) {
+    if (child != nullptr && child->getParent() != node)
+      return false;
+  }
+  return parentLinksValid(node->getLeftChild()) &&
+         parentLinksValid(node->getRightChild());
+}
+
+TEST(RBTEngine, TopDownInsertKeepsInvariants) {
+  mt19937 generator(38);
+  for (int round = 0; round < 3; round++) {
+    IntTree tree;
+    tree.setInsertMode(InsertMode::kTopDown);
+    set<int> keys;
+    for (int i = 0; i < 4000; i++) {
+      // Ascending, descending and random orders, with duplicates.
+      const int key = (round == 0)   ? i
+                      : (round == 1) ? 4000 - i
+                                     : static_cast<int>(generator() % 3000);
+      IntTree::InsertResult result = tree.insert(key, i);
+      EXPECT_EQ(result.second, keys.insert(key).second
+                                   ? IntTree::kIsNewlyInserted
+                                   : IntTree::kIsDuplicateNode);
+      EXPECT_EQ(result.first->getKey(), key);
+      if (i % 97 == 0) {
+        ASSERT_GT(blackHeight(tree.root()), 0);
+        ASSERT_TRUE(parentLinksValid(tree.root()));
+        ASSERT_EQ(tree.root()->getColor(), 'B');
+      }
+    }
+    EXPECT_GT(blackHeight(tree.root()), 0);
+    EXPECT_TRUE(parentLinksValid(tree.root()));
+    EXPECT_EQ(tree.size(), static_cast<int>(keys.size()));
+    set<int>::iterator expected = keys.begin();
+    for (IntTree::Node *node = tree.first(); node != nullptr;
+         node = IntTree::successor(node), ++expected)
+      EXPECT_EQ(node->getKey(), *expected);
+
+    // Erase still works on a tree shaped top-down.
+    for (int key = 0; key < 3000; key += 2) {
+      if (IntTree::Node *node = tree.find(key))
+        tree.erase(node);
+    }
+    EXPECT_GT(blackHeight(tree.root()), 0);
+  }
+}
+
+// The sample's insertion order gives the same depths in both modes.
+TEST(RBTEngine, TopDownSampleDepths) {
+  CompositeTree tree;
+  tree.setInsertMode(InsertMode::kTopDown);
+  const pair<int, string> keys[] = {
+      {12201234, "Algorithms"}, {12221622, "Algorithms"},
+      {12201234, "Misaso"},     {12211748, "Algorithms"},
+      {12243343, "Misaso"},     {12215201, "Mathmatics"}};
+  const int expected_depths[] = {0, 1, 0, 2, 2, 3};
+  for (int i = 0; i < 6; i++) {
+    CompositeTree::InsertResult result = tree.insert(keys[i], i);
+    EXPECT_EQ(CompositeTree::getNodeDepth(result.first), expected_depths[i]);
+  }
+}
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,115 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-07-03
+ */
+#include "../../src/design_assignment_01/batch_driver.hpp"
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <unistd.h>
+
+TEST(BatchDriver, OutputPath) {
+  EXPECT_EQ(batchOutputPath("docs/sample-P1.1.in", ""), "docs/sample-P1.1.out");
+  EXPECT_EQ(batchOutputPath("docs/log.txt", ""), "docs/log.txt.out");
+  EXPECT_EQ(batchOutputPath("docs/sample-P1.1.in", "out"),
+            "out/sample-P1.1.out");
+}
+
+TEST(BatchDriver, ArenaReusesBlocks) {
+  NodeArena arena(1024);
+  for (int round = 0; round < 3; round++) {
+    {
+      BasicRedBlackTree<int, int, IntKeyComparator> tree(&arena);
+      for (int i = 0; i < 500; i++)
+        tree.insert(i, i);
+      EXPECT_EQ(tree.size(), 500);
+      EXPECT_NE(tree.find(499), nullptr);
+    }
+    const size_t reserved = arena.reservedBytes();
+    arena.reset();
+    if (round > 0) {
+      // The second and later rounds fit in the blocks of the first one.
+      EXPECT_EQ(arena.reservedBytes(), reserved);
+    }
+  }
+}
+
+TEST(BatchDriver, PoolRunsEveryTask) {
+  atomic<int> sum(0);
+  WorkStealingPool pool(3);
+  for (int i = 1; i <= 100; i++) {
+    pool.submit([&sum, i](int worker_index) {
+      EXPECT_GE(worker_index, 0);
+      EXPECT_LT(worker_index, 3);
+      sum += i;
+    });
+  }
+  pool.wait();
+  EXPECT_EQ(sum, 5050);
+}
+
+TEST(BatchDriver, ArenaReusesErasedNodes) {
+  NodeArena arena(1024);
+  BasicRedBlackTree<int, int, IntKeyComparator> tree(&arena);
+  for (int i = 0; i < 100; i++)
+    tree.insert(i, i);
+  const size_t reserved = arena.reservedBytes();
+
+  // Each update erases a node and inserts one of the same size.
+  for (int round = 0; round < 10000; round++) {
+    const int key = round % 100;
+    tree.erase(tree.find(key));
+    tree.insert(key, round);
+  }
+  EXPECT_EQ(tree.size(), 100);
+  EXPECT_EQ(arena.reservedBytes(), reserved);
+}
+
+TEST(BatchDriver, PoolSurvivesThrowingTask) {
+  atomic<int> finished(0);
+  WorkStealingPool pool(2);
+  for (int i = 0; i < 10; i++) {
+    pool.submit([&finished, i](int) {
+      if (i == 3)
+        throw runtime_error("task failed");
+      finished++;
+    });
+  }
+  EXPECT_THROW(pool.wait(), runtime_error);
+  EXPECT_EQ(finished, 9);
+
+  // The failure is reported once; the pool keeps working.
+  pool.submit([&finished](int) { finished++; });
+  pool.wait();
+  EXPECT_EQ(finished, 10);
+}
+
+TEST(BatchDriver, FailedWriteCountsAsFailedFile) {
+  if (access("/dev/full", W_OK) != 0)
+    GTEST_SKIP() << "/dev/full is not available";
+  const string base = testing::TempDir() + "batch_driver_full";
+  const string input_path = base + ".in";
+  const string output_path = base + ".out";
+  FILE *input = fopen(input_path.c_str(), "wb");
+  ASSERT_NE(input, nullptr);
+  fputs("1\nI 12201234 Algorithms Minseok 6 01023456789 10204\n", input);
+  fclose(input);
+  remove(output_path.c_str());
+  ASSERT_EQ(symlink("/dev/full", output_path.c_str()), 0);
+
+  BatchOptions options;
+  options.thread_count = 1;
+  EXPECT_EQ(runBatch({input_path}, options), 1);
+  remove(output_path.c_str());
+  remove(input_path.c_str());
+}
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,151 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-07-03
+ */
+#include "../../src/design_assignment_01/concurrent_registration_index.hpp"
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <set>
+#include <thread>
+
+// Counts live instances so that tests can observe reclamation.
+struct CountedObject {
+  explicit CountedObject(atomic<int> &live_count) : live_count(live_count) {
+    live_count++;
+  }
+  ~CountedObject() { live_count--; }
+  atomic<int> &live_count;
+};
+
+TEST(ConcurrentRegistration, ReclaimerWaitsForPinnedReaders) {
+  atomic<int> live_count(0);
+  {
+    EpochReclaimer reclaimer(2);
+    reclaimer.enter(1);
+    reclaimer.enter(0);
+    reclaimer.retire(0, new CountedObject(live_count));
+    reclaimer.exit(0);
+
+    // Thread 1 is pinned in the retiring epoch, so nothing may be freed.
+    for (int i = 0; i < 4; i++)
+      reclaimer.tryAdvance();
+    reclaimer.reclaim(0);
+    EXPECT_EQ(reclaimer.pendingCount(0), 1u);
+
+    reclaimer.exit(1);
+    EXPECT_TRUE(reclaimer.tryAdvance());
+    EXPECT_TRUE(reclaimer.tryAdvance());
+    reclaimer.reclaim(0);
+    EXPECT_EQ(reclaimer.pendingCount(0), 0u);
+    EXPECT_EQ(live_count.load(), 0);
+
+    reclaimer.enter(0);
+    reclaimer.retire(0, new CountedObject(live_count));
+    reclaimer.exit(0);
+  }
+  // The destructor frees whatever is still waiting.
+  EXPECT_EQ(live_count.load(), 0);
+}
+
+TEST(ConcurrentRegistration, ConcurrentInsertMatchesSequential) {
+  static const char *kSubjects[] = {"Algo", "Algorithms", "Misaso", "Math",
+                                    "Physics", "Zoology"};
+  const int thread_count = 4;
+  const int insert_count = 20000;
+
+  // Every thread replays the same keys in its own order; a key always
+  // carries the same timestamp so the final state is deterministic.
+  vector<tuple<int, string, int>> inserts;
+  mt19937 generator(33);
+  map<pair<int, string>, int> expected;
+  for (int i = 0; i < insert_count; i++) {
+    const int sid = 100 + generator() % 500;
+    const string subject = kSubjects[generator() % 6];
+    auto inserted =
+        expected.insert(make_pair(make_pair(sid, subject), i));
+    inserts.emplace_back(sid, subject, inserted.first->second);
+  }
+
+  ConcurrentRegistrationIndex index(thread_count);
+  atomic<int> newly_inserted(0);
+  vector<thread> writers;
+  for (int t = 0; t < thread_count; t++) {
+    writers.emplace_back([&, t]() {
+      vector<tuple<int, string, int>> order = inserts;
+      shuffle(order.begin(), order.end(), mt19937(t));
+      vector<SubjectTimestampPair> subjects;
+      for (size_t i = 0; i < order.size(); i++) {
+        const bool status = index.inquireInsert(
+            get<0>(order[i]), get<1>(order[i]), "N", 1, "010",
+            get<2>(order[i]), t);
+        newly_inserted += (status == StudentSkiplist::kIsNewlyInserted);
+        // Concurrent scans must see each student's subjects in order.
+        if (i % 16 == 0) {
+          index.inquireAllSubjects(get<0>(order[i]), subjects, t);
+          for (size_t j = 1; j < subjects.size(); j++)
+            EXPECT_LT(subjects[j - 1].first, subjects[j].first);
+        }
+      }
+    });
+  }
+  for (thread &writer : writers)
+    writer.join();
+
+  EXPECT_EQ(index.size(), expected.size());
+  EXPECT_EQ(newly_inserted.load(), static_cast<int>(expected.size()));
+
+  vector<SubjectTimestampPair> subjects;
+  for (int sid = 99; sid < 601; sid++) {
+    vector<SubjectTimestampPair> wanted;
+    for (auto it = expected.lower_bound(make_pair(sid, string()));
+         it != expected.end() && it->first.first == sid; ++it)
+      wanted.push_back(SubjectTimestampPair(it->first.second, it->second));
+    EXPECT_EQ(index.inquireAllSubjects(sid, subjects, 0), !wanted.empty());
+    EXPECT_EQ(subjects, wanted);
+  }
+}
+
+TEST(ConcurrentRegistration, RacingReRegistrationsKeepEveryTimestamp) {
+  const int thread_count = 4;
+  const int updates_per_thread = 5000;
+  ConcurrentRegistrationIndex index(thread_count);
+  index.inquireInsert(7, "Algo", "N", 1, "010", -1, 0);
+
+  vector<thread> writers;
+  for (int t = 0; t < thread_count; t++) {
+    writers.emplace_back([&, t]() {
+      for (int i = 0; i < updates_per_thread; i++)
+        index.inquireInsert(7, "Algo", "N", 1, "010",
+                            t * updates_per_thread + i, t);
+    });
+  }
+  for (thread &writer : writers)
+    writer.join();
+
+  // The history plus the current timestamp hold every timestamp once.
+  vector<int> history;
+  ASSERT_TRUE(index.inquireTimestampHistory(7, "Algo", history, 0));
+  ASSERT_EQ(history.size(),
+            static_cast<size_t>(thread_count * updates_per_thread));
+  EXPECT_EQ(history.front(), -1);
+  vector<SubjectTimestampPair> subjects;
+  ASSERT_TRUE(index.inquireAllSubjects(7, subjects, 0));
+  history.push_back(subjects[0].second);
+  sort(history.begin(), history.end());
+  for (size_t i = 0; i < history.size(); i++)
+    EXPECT_EQ(history[i], static_cast<int>(i) - 1);
+
+  EXPECT_FALSE(index.inquireTimestampHistory(7, "Alg", history, 0));
+  EXPECT_TRUE(history.empty());
+}
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,256 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-07-03
+ */
+#include "../../src/design_assignment_01/query_pipeline.hpp"
+#include <gtest/gtest.h>
+
+// Input and expected output of docs/sample-P1.1.
+static const char *kSampleInput =
+    "12\n"
+    "I 12201234 Algorithms Minseok 6 01023456789 10204\n"
+    "I 12221622 Algorithms Yunseok 5 01091098270 15104\n"
+    "I 12201234 Misaso Minseok 6 01023456789 15220\n"
+    "I 12211748 Algorithms Hyesu 5 01058172356 16773\n"
+    "I 12243343 Misaso Yujeong 3 01071919284 16832\n"
+    "I 12215201 Mathmatics Changmin 7 01067685291 17503\n"
+    "M Algorithms 2\n"
+    "I 12201234 Algorithms Minseok 6 01023456789 20115\n"
+    "M Algorithms 2\n"
+    "L 12201234\n"
+    "C Misaso\n"
+    "M Algorithms 4\n";
+static const char *kSampleOutput = "0 0\n1 0\n0 0\n2 0\n2 0\n3 0\n"
+                                   "12201234 B 12221622 R \n"
+                                   "1 1\n"
+                                   "12221622 R 12211748 B \n"
+                                   "Algorithms B Misaso B \n"
+                                   "2 2\n"
+                                   "12221622 R 12211748 B 12201234 B \n";
+
+// Writes 'text' to a temporary file rewound for reading.
+static FILE *openInput(const char *text) {
+  FILE *file = tmpfile();
+  fputs(text, file);
+  rewind(file);
+  return file;
+}
+
+// Reads back everything written to a temporary output file.
+static string readOutput(FILE *file) {
+  rewind(file);
+  string text;
+  char chunk[256];
+  size_t length;
+  while ((length = fread(chunk, 1, sizeof(chunk), file)) > 0)
+    text.append(chunk, length);
+  return text;
+}
+
+TEST(QueryPipeline, SpscRingKeepsOrder) {
+  SpscRing<int> ring(4);
+  thread producer([&]() {
+    for (int i = 1; i <= 1000; i++) {
+      int value = i;
+      ring.push(move(value));
+    }
+  });
+  for (int i = 1; i <= 1000; i++) {
+    int value = 0;
+    ring.pop(value);
+    EXPECT_EQ(value, i);
+  }
+  producer.join();
+}
+
+TEST(QueryPipeline, SequentialMatchesSample) {
+  FILE *input = openInput(kSampleInput);
+  FILE *output = tmpfile();
+  RedBlackTree tree;
+  runSequential(tree, input, output);
+  EXPECT_EQ(readOutput(output), kSampleOutput);
+  fclose(input);
+  fclose(output);
+}
+
+TEST(QueryPipeline, PipelineMatchesSample) {
+  for (size_t batch_size : {1, 3, 1024}) {
+    FILE *input = openInput(kSampleInput);
+    FILE *output = tmpfile();
+    RedBlackTree tree;
+    PipelineOptions options;
+    options.batch_size = batch_size;
+    options.ring_capacity = 2;
+    runPipeline(tree, input, output, options);
+    EXPECT_EQ(readOutput(output), kSampleOutput);
+    fclose(input);
+    fclose(output);
+  }
+}
+
+TEST(QueryPipeline, PlannerCoalescesRepeatedReads) {
+  static const char *kLines[] = {
+      "I 12201234 Algorithms Minseok 6 01023456789 10204",
+      "I 12221622 Algorithms Yunseok 5 01091098270 15104",
+      "I 12201234 Misaso Minseok 6 01023456789 15220",
+      "M Algorithms 2", "M Algorithms 1", "C Algorithms", "M Algorithms 4",
+      "L 12201234", "E * 1", "L 12201234", "E * 3", "A Algorithms 1 20000",
+      "A Algorithms 5 20000", "A Algorithms 5 15104", "C Algorithms",
+      "I 12201234 Algorithms Minseok 6 01023456789 20115",
+      "M Algorithms 1", "M Algorithms 0", "L 99"};
+  vector<Query> queries;
+  for (const char *line : kLines) {
+    Query query;
+    ASSERT_TRUE(parseQueryLine(line, line + strlen(line), query));
+    queries.push_back(query);
+  }
+
+  RedBlackTree single_tree;
+  RedBlackTree planned_tree;
+  QueryPlanner planner(planned_tree);
+  vector<QueryResponse> planned(queries.size());
+  planner.execute(queries.data(), queries.size(), planned.data());
+  for (size_t i = 0; i < queries.size(); i++) {
+    QueryResponse response;
+    single_tree.execute(queries[i], response);
+    string expected;
+    string actual;
+    ResponseFormatter::append(expected, response);
+    ResponseFormatter::append(actual, planned[i]);
+    EXPECT_EQ(actual, expected) << kLines[i];
+  }
+
+  // Run 1: M x3 (one each), C x2, L x2, E x2, A(T=20000) x2, A(T=15104)
+  // -> 8 groups. Run 2: M x2 (one each), L -> 3 groups.
+  const PlannerStats &stats = planner.stats();
+  EXPECT_EQ(stats.read_runs, 2u);
+  EXPECT_EQ(stats.read_queries, 15u);
+  EXPECT_EQ(stats.computed_queries, 11u);
+  EXPECT_EQ(stats.coalesced_queries, 4u);
+}
+
+TEST(QueryPipeline, PlannedTiesMatchSequentialRuns) {
+  // 60 registrations share one timestamp, so M is decided by the tie order,
+  // which every in-place sort may change. Output of the reference solution:
+  static const char *kReferenceOutput[] = {
+      "1045 B 1007 R 1044 R 1021 R 1058 B \n",
+      "1000 B 1037 B 1014 R \n",
+      "1045 B 1007 R 1044 R 1021 R 1058 B \n",
+      "1000 B 1037 B 1014 R 1051 B 1028 B 1005 B 1042 R 1019 R 1056 B "
+      "1033 B 1010 B 1047 B 1024 B 1001 B 1038 B 1015 B 1052 B 1029 B "
+      "1006 B 1043 B 1020 B 1057 R 1034 R 1011 R 1048 R 1025 R 1002 R "
+      "1039 B 1016 B 1053 R 1030 R 1007 R 1044 R 1021 R 1058 B 1035 B "
+      "1012 B 1049 B 1026 B 1003 B 1040 B 1017 B 1054 B 1031 B 1008 B "
+      "1045 B 1022 B 1059 R 1036 R 1013 R 1050 R 1027 R 1004 R 1041 R "
+      "1018 R 1055 R 1032 R 1009 R 1046 R 1023 R \n",
+      "1045 B \n",
+      "1000 B 1037 B 1014 R 1051 B 1028 B \n",
+  };
+  static const int kQueryK[] = {5, 3, 5, 60, 1, 5};
+  vector<Query> queries;
+  for (int i = 0; i < 60; i++) {
+    const string line =
+        "I " + to_string(1000 + (i * 37) % 60) + " X N 1 010 5";
+    Query query;
+    ASSERT_TRUE(parseQueryLine(line.data(), line.data() + line.size(), query));
+    queries.push_back(query);
+  }
+  for (int k : kQueryK) {
+    const string line = "M X " + to_string(k);
+    Query query;
+    ASSERT_TRUE(parseQueryLine(line.data(), line.data() + line.size(), query));
+    queries.push_back(query);
+  }
+
+  RedBlackTree single_tree;
+  RedBlackTree planned_tree;
+  QueryPlanner planner(planned_tree);
+  vector<QueryResponse> planned(queries.size());
+  planner.execute(queries.data(), queries.size(), planned.data());
+  for (size_t i = 0; i < queries.size(); i++) {
+    QueryResponse response;
+    single_tree.execute(queries[i], response);
+    string expected;
+    string actual;
+    ResponseFormatter::append(expected, response);
+    ResponseFormatter::append(actual, planned[i]);
+    EXPECT_EQ(actual, expected) << i;
+    if (i >= 60) {
+      EXPECT_EQ(actual, kReferenceOutput[i - 60]) << i;
+    }
+  }
+  EXPECT_EQ(planner.stats().coalesced_queries, 0u);
+}
+
+TEST(QueryPipeline, UnknownQueryLinesAreSkipped) {
+  // The unknown lines count toward the query total, so the trailing C is
+  // never read.
+  static const char *kInput = "5\n"
+                              "X 12201234 Algorithms\n"
+                              "I 12201234 Algorithms Minseok 6 01023456789 10\n"
+                              "Q\n"
+                              "C Algorithms\n"
+                              "L 12201234\n"
+                              "C Algorithms\n";
+  static const char *kOutput = "0 0\n1 0\nAlgorithms B \n";
+  for (size_t batch_size : {0, 1, 1024}) {
+    FILE *input = openInput(kInput);
+    FILE *output = tmpfile();
+    RedBlackTree tree;
+    if (batch_size == 0) {
+      runSequential(tree, input, output);
+    } else {
+      PipelineOptions options;
+      options.batch_size = batch_size;
+      runPipeline(tree, input, output, options);
+    }
+    EXPECT_EQ(readOutput(output), kOutput) << "batch size " << batch_size;
+    fclose(input);
+    fclose(output);
+  }
+}
+
+TEST(QueryPipeline, ReadIntRejectsNonDigits) {
+  FILE *input = openInput("abc -x 42");
+  QueryReader reader(input);
+  int value = 7;
+  EXPECT_FALSE(reader.readInt(value));
+  string token;
+  ASSERT_TRUE(reader.readToken(token));
+  EXPECT_EQ(token, "abc");
+  EXPECT_FALSE(reader.readInt(value));
+  ASSERT_TRUE(reader.readToken(token));
+  EXPECT_EQ(token, "x");
+  EXPECT_TRUE(reader.readInt(value));
+  EXPECT_EQ(value, 42);
+  fclose(input);
+}
+
+TEST(QueryPipeline, ReadIntRejectsOverflow) {
+  FILE *input = openInput("2147483647 -2147483647 2147483648 9999999999");
+  QueryReader reader(input);
+  int value = 7;
+  EXPECT_TRUE(reader.readInt(value));
+  EXPECT_EQ(value, INT_MAX);
+  EXPECT_TRUE(reader.readInt(value));
+  EXPECT_EQ(value, -INT_MAX);
+  EXPECT_FALSE(reader.readInt(value));
+  fclose(input);
+
+  Query query;
+  for (const char *line : {"L 2147483648", "L -9999999999"})
+    EXPECT_FALSE(parseQueryLine(line, line + strlen(line), query)) << line;
+  const char *line = "L -2147483647";
+  ASSERT_TRUE(parseQueryLine(line, line + strlen(line), query));
+  EXPECT_EQ(query.sid, -INT_MAX);
+}
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
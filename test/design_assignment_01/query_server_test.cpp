@@ -0,0 +1,106 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-07-03
+ */
+#include "../../src/design_assignment_01/query_server.hpp"
+#include <gtest/gtest.h>
+
+// One client connected to a QueryServer through a socketpair.
+class RBTQueryServer : public ::testing::Test {
+protected:
+  void SetUp() override {
+    int fds[2];
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+    client_fd = fds[0];
+    ASSERT_TRUE(server.addClient(fds[1]));
+    ASSERT_EQ(fcntl(client_fd, F_SETFL, O_NONBLOCK), 0);
+  }
+
+  void TearDown() override {
+    if (client_fd >= 0)
+      close(client_fd);
+  }
+
+  void send(const string &text) {
+    ASSERT_EQ(write(client_fd, text.data(), text.size()),
+              static_cast<ssize_t>(text.size()));
+  }
+
+  // Serves until 'line_count' response lines arrived or the server closed
+  // the connection, and returns what was received.
+  string receive(int line_count) {
+    string received;
+    char chunk[4096];
+    for (int round = 0; round < 200; round++) {
+      if (count(received.begin(), received.end(), '\n') >= line_count)
+        break;
+      server.serveEvents(1);
+      ssize_t length = read(client_fd, chunk, sizeof(chunk));
+      if (length == 0) {
+        peer_closed = true;
+        break;
+      }
+      if (length > 0)
+        received.append(chunk, length);
+    }
+    return received;
+  }
+
+  RedBlackTree tree;
+  QueryServer server{tree, ""};
+  int client_fd = -1;
+  bool peer_closed = false;
+};
+
+TEST(RBTQueryLine, RejectsMalformedLines) {
+  Query query;
+  const char *lines[] = {"", "X 1", "L", "L -", "L 12a", "L 1 2",
+                         "M Algorithms", "IL 1"};
+  for (const char *line : lines)
+    EXPECT_FALSE(parseQueryLine(line, line + strlen(line), query)) << line;
+
+  const char *valid = "L -12";
+  ASSERT_TRUE(parseQueryLine(valid, valid + strlen(valid), query));
+  EXPECT_EQ(query.sid, -12);
+}
+
+TEST_F(RBTQueryServer, AnswersPipelinedLinesInOrder) {
+  send("I 1 Algorithms N 1 010 5\n"
+       "I 2 Algorithms N 1 010 3\n"
+       "C Algorithms\n"
+       "M Algorithms 2\n");
+  EXPECT_EQ(receive(4), "0 0\n1 0\n2 1\n2 R 1 B \n");
+}
+
+TEST_F(RBTQueryServer, JoinsALineSplitAcrossReads) {
+  send("I 1 Algor");
+  EXPECT_EQ(receive(1), "");
+  send("ithms N 1 010 5\nC Algo");
+  EXPECT_EQ(receive(1), "0 0\n");
+  send("rithms\n");
+  EXPECT_EQ(receive(1), "1 0\n");
+}
+
+TEST_F(RBTQueryServer, AnswersAnInvalidLineAndKeepsServing) {
+  send("I 1 Algorithms N 1 010 5\nL -\nC Algorithms\n");
+  EXPECT_EQ(receive(3), string("0 0\n") + kInvalidQueryMessage + "\n1 0\n");
+  EXPECT_FALSE(peer_closed);
+}
+
+TEST_F(RBTQueryServer, AnswersAHalfClosedClientThenCloses) {
+  send("I 1 Algorithms N 1 010 5\nL 1\n");
+  ASSERT_EQ(shutdown(client_fd, SHUT_WR), 0);
+  EXPECT_EQ(receive(2), "0 0\nAlgorithms B \n");
+  receive(3);
+  EXPECT_TRUE(peer_closed);
+}
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
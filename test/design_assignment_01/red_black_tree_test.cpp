@@ -0,0 +1,338 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-07-03
+ */
+#include "../../src/design_assignment_01/query_io.hpp"
+#include "../../src/design_assignment_01/red_black_tree.hpp"
+#include <gtest/gtest.h>
+#include <random>
+#include <tuple>
+
+// Executes one query line and returns its formatted response.
+static string runLine(RedBlackTree &tree, const string &line) {
+  Query query;
+  QueryResponse response;
+  EXPECT_TRUE(parseQueryLine(line.data(), line.data() + line.size(), query));
+  tree.execute(query, response);
+  string text;
+  ResponseFormatter::append(text, response);
+  return text;
+}
+
+TEST(RBTRegistration, GlobalEarliestFollowsRetimestamp) {
+  RedBlackTree tree;
+  runLine(tree, "I 12201234 Algorithms Minseok 6 01023456789 10204");
+  runLine(tree, "I 12221622 Algorithms Yunseok 5 01091098270 15104");
+  runLine(tree, "I 12201234 Misaso Minseok 6 01023456789 15220");
+  EXPECT_EQ(runLine(tree, "E * 2"),
+            "12201234 Algorithms R 12221622 Algorithms R \n");
+
+  // Re-registering moves the record to the back of the global order.
+  runLine(tree, "I 12201234 Algorithms Minseok 6 01023456789 20115");
+  EXPECT_EQ(runLine(tree, "E * 3"),
+            "12221622 Algorithms R 12201234 Misaso B 12201234 Algorithms R \n");
+  EXPECT_EQ(runLine(tree, "E Mis 5"), "12201234 Misaso B \n");
+  EXPECT_EQ(runLine(tree, "E Physics 5"), "No records found\n");
+}
+
+TEST(RBTRegistration, GlobalEarliestMatchesBruteForce) {
+  static const char *kSubjects[] = {"Algo", "Algorithms", "Misaso", "Math",
+                                    "Mathmatics", "Physics"};
+  mt19937 generator(30);
+  RedBlackTree tree;
+  map<pair<int, string>, int> timestamps;
+  for (int i = 0; i < 3000; i++) {
+    const int sid = 100 + generator() % 300;
+    const string subject = kSubjects[generator() % 6];
+    const int timestamp = generator() % 100000;
+    timestamps[make_pair(sid, subject)] = timestamp;
+    runLine(tree, "I " + to_string(sid) + " " + subject + " N 1 010 " +
+                      to_string(timestamp));
+  }
+
+  for (const string prefix : {"*", "Al", "Math", "M", "Physics"}) {
+    vector<tuple<int, int, string>> expected;
+    for (const auto &entry : timestamps) {
+      if (prefix == "*" || entry.first.second.compare(0, prefix.size(),
+                                                      prefix) == 0)
+        expected.emplace_back(entry.second, entry.first.first,
+                              entry.first.second);
+    }
+    sort(expected.begin(), expected.end());
+
+    Query query;
+    QueryResponse response;
+    const string line = "E " + prefix + " 50";
+    ASSERT_TRUE(parseQueryLine(line.data(), line.data() + line.size(), query));
+    tree.execute(query, response);
+    ASSERT_EQ(response.entries.size(), 50u);
+    for (size_t i = 0; i < 50; i++) {
+      EXPECT_EQ(response.entries[i].sid, get<1>(expected[i]));
+      EXPECT_EQ(*response.entries[i].subject, get<2>(expected[i]));
+    }
+  }
+}
+
+TEST(RBTRegistration, AsOfSeesOldTimestamps) {
+  RedBlackTree tree;
+  runLine(tree, "I 12201234 Algorithms Minseok 6 01023456789 10204");
+  runLine(tree, "I 12221622 Algorithms Yunseok 5 01091098270 15104");
+  runLine(tree, "I 12211748 Algorithms Hyesu 5 01058172356 16773");
+  runLine(tree, "I 12201234 Algorithms Minseok 6 01023456789 20115");
+
+  EXPECT_EQ(runLine(tree, "A Algorithms 2 20000"), "12201234 R 12221622 R \n");
+  EXPECT_EQ(runLine(tree, "A Algorithms 5 15104"), "12201234 R 12221622 R \n");
+  EXPECT_EQ(runLine(tree, "A Algorithms 5 10000"), "\n");
+  EXPECT_EQ(runLine(tree, "A Algorithms 3 30000"),
+            runLine(tree, "M Algorithms 3"));
+}
+
+TEST(RBTRegistration, AsOfListsEachStudentOnce) {
+  RedBlackTree tree;
+  runLine(tree, "I 1 Algorithms N 1 010 3");
+  runLine(tree, "I 1 Algorithms N 1 010 10");
+  runLine(tree, "I 1 Algorithms N 1 010 7");
+  runLine(tree, "I 2 Algorithms N 1 010 4");
+
+  // Versions 3 and 7 of student 1 are both current at 8.
+  EXPECT_EQ(runLine(tree, "A Algorithms 5 8"), "1 B 2 R \n");
+  EXPECT_EQ(runLine(tree, "A Algorithms 1 8"), "1 B \n");
+  EXPECT_EQ(runLine(tree, "A Algorithms 5 12"), "2 R 1 B \n");
+}
+
+TEST(RBTRegistration, AsOfMatchesReplay) {
+  mt19937 generator(31);
+  RedBlackTree tree;
+  // Log of (time, sid) re-registrations for one subject; times increase.
+  vector<pair<int, int>> log;
+  for (int time = 1; time <= 2000; time++) {
+    const int sid = 1000 + generator() % 150;
+    log.emplace_back(time, sid);
+    runLine(tree, "I " + to_string(sid) + " Algorithms N 1 010 " +
+                      to_string(time));
+  }
+
+  for (int as_of : {1, 77, 500, 1234, 2000}) {
+    // Replay the log up to 'as_of' to get each student's timestamp then.
+    map<int, int> timestamp_of;
+    for (const pair<int, int> &entry : log)
+      if (entry.first <= as_of)
+        timestamp_of[entry.second] = entry.first;
+    vector<pair<int, int>> expected;
+    for (const pair<const int, int> &entry : timestamp_of)
+      expected.emplace_back(entry.second, entry.first);
+    sort(expected.begin(), expected.end());
+
+    Query query;
+    QueryResponse response;
+    const string line = "A Algorithms 20 " + to_string(as_of);
+    ASSERT_TRUE(parseQueryLine(line.data(), line.data() + line.size(), query));
+    tree.execute(query, response);
+    ASSERT_EQ(response.entries.size(), min<size_t>(20, expected.size()));
+    for (size_t i = 0; i < response.entries.size(); i++)
+      EXPECT_EQ(response.entries[i].sid, expected[i].second);
+  }
+}
+
+TEST(RBTRegistration, EytzingerLowerBoundMatchesSortedSearch) {
+  for (int key_count = 0; key_count < 70; key_count++) {
+    vector<int> keys;
+    for (int i = 0; i < key_count; i++)
+      keys.push_back(2 * i);
+    EytzingerIndex<int, IntKeyComparator> index;
+    index.build(keys);
+    for (int probe = -1; probe <= 2 * key_count; probe++) {
+      EXPECT_EQ(index.lowerBound(probe),
+                static_cast<size_t>(lower_bound(keys.begin(), keys.end(),
+                                                probe) -
+                                    keys.begin()));
+    }
+  }
+}
+
+TEST(RBTRegistration, FrozenMatchesMutable) {
+  static const char *kSubjects[] = {"Algo", "Algorithms", "Misaso", "Math",
+                                    "Physics"};
+  mt19937 generator(32);
+  RedBlackTree tree;
+  RedBlackTree mutable_tree;
+  for (int i = 0; i < 2000; i++) {
+    const string line = "I " + to_string(100 + generator() % 400) + " " +
+                        kSubjects[generator() % 5] + " N 1 010 " +
+                        to_string(generator() % 100000);
+    runLine(tree, line);
+    runLine(mutable_tree, line);
+  }
+
+  vector<string> lines;
+  for (int sid = 98; sid < 502; sid++)
+    lines.push_back("L " + to_string(sid));
+  for (const char *subject : kSubjects) {
+    lines.push_back(string("C ") + subject);
+    lines.push_back(string("M ") + subject + " 7");
+    lines.push_back(string("M ") + subject + " 100000");
+  }
+  // Ties in M come out in the order the in-place sorts leave them, so the
+  // answers are compared with an identical tree that never freezes.
+  vector<string> expected;
+  for (const string &line : lines)
+    expected.push_back(runLine(mutable_tree, line));
+
+  const int frozen_count = stoi(runLine(tree, "F"));
+  EXPECT_GT(frozen_count, 1000);
+  EXPECT_TRUE(tree.isFrozen());
+  for (size_t i = 0; i < lines.size(); i++)
+    EXPECT_EQ(runLine(tree, lines[i]), expected[i]) << lines[i];
+
+  // An insert thaws, after which the mutable maps answer again.
+  runLine(tree, "I 999 Algo N 1 010 5");
+  EXPECT_FALSE(tree.isFrozen());
+  EXPECT_EQ(runLine(tree, "L 999"), "Algo R \n");
+  EXPECT_EQ(runLine(tree, "T"), to_string(frozen_count + 1) + "\n");
+}
+
+TEST(RBTRegistration, FrozenTiesMatchMutableTree) {
+  RedBlackTree tree;
+  RedBlackTree mutable_tree;
+  mt19937 generator(33);
+  vector<int> sids;
+  for (int i = 0; i < 60; i++)
+    sids.push_back(1000 + i);
+  shuffle(sids.begin(), sids.end(), generator);
+  for (int sid : sids) {
+    const string line = "I " + to_string(sid) + " X N 1 010 " +
+                        to_string(sid % 3);
+    runLine(tree, line);
+    runLine(mutable_tree, line);
+  }
+  runLine(tree, "I 1 Y N 1 010 1");
+  runLine(mutable_tree, "I 1 Y N 1 010 1");
+
+  // X is all ties, so its frozen M keeps sorting the mutable vector; every
+  // answer must be what the tree that never freezes prints.
+  EXPECT_EQ(runLine(tree, "M X 5"), runLine(mutable_tree, "M X 5"));
+  runLine(tree, "F");
+  for (int k : {5, 60, 3, 5})
+    EXPECT_EQ(runLine(tree, "M X " + to_string(k)),
+              runLine(mutable_tree, "M X " + to_string(k)));
+  EXPECT_EQ(runLine(tree, "C X"), runLine(mutable_tree, "C X"));
+  EXPECT_EQ(runLine(tree, "M Y 1"), runLine(mutable_tree, "M Y 1"));
+  runLine(tree, "T");
+  EXPECT_EQ(runLine(tree, "M X 5"), runLine(mutable_tree, "M X 5"));
+}
+
+TEST(RBTRegistration, ExecuteBatchMatchesExecute) {
+  static const char *kSubjects[] = {"Algo", "Algorithms", "Misaso", "Math"};
+  mt19937 generator(35);
+  vector<Query> queries;
+  for (int i = 0; i < 3000; i++) {
+    string line;
+    const int sid = 100 + generator() % 200;
+    const string subject = kSubjects[generator() % 4];
+    switch (generator() % 6) {
+    case 0:
+    case 1:
+      line = "I " + to_string(sid) + " " + subject + " N 1 010 " +
+             to_string(generator() % 100000);
+      break;
+    case 2:
+    case 3:
+      line = "L " + to_string(sid);
+      break;
+    case 4:
+      line = "E * 3";
+      break;
+    default:
+      line = "F";
+      break;
+    }
+    // M and C need a subject that has been registered already.
+    if (i == 0)
+      line = "I 100 Algo N 1 010 1";
+    if (line == "E * 3" && generator() % 2)
+      line = "C Algo";
+    Query query;
+    ASSERT_TRUE(parseQueryLine(line.data(), line.data() + line.size(), query));
+    queries.push_back(query);
+  }
+
+  RedBlackTree single_tree;
+  RedBlackTree batch_tree;
+  vector<QueryResponse> batch_responses(queries.size());
+  batch_tree.executeBatch(queries.data(), queries.size(),
+                          batch_responses.data());
+  for (size_t i = 0; i < queries.size(); i++) {
+    QueryResponse response;
+    single_tree.execute(queries[i], response);
+    string expected;
+    string actual;
+    ResponseFormatter::append(expected, response);
+    ResponseFormatter::append(actual, batch_responses[i]);
+    EXPECT_EQ(actual, expected) << i;
+  }
+}
+
+// Returns the (bytes, objects) of 'component' from an executed "S" query.
+static pair<size_t, size_t> memoryOf(RedBlackTree &tree,
+                                     MemoryComponent component) {
+  QueryResponse response;
+  tree.inquireMemoryUsage(response);
+  const MemoryUsage &usage =
+      response.memory_usage[static_cast<int>(component)];
+  EXPECT_STREQ(usage.component,
+               MemoryLedger::kComponentNames[static_cast<int>(component)]);
+  return make_pair(usage.bytes, usage.objects);
+}
+
+TEST(RBTRegistration, MemoryLedgerTracksComponents) {
+  RedBlackTree tree;
+  const string long_name(64, 'n');
+  runLine(tree, "I 1 Algorithms " + long_name + " 1 010 5");
+  runLine(tree, "I 1 Misaso N 1 010 6");
+  runLine(tree, "I 2 Misaso N 1 010 7");
+
+  EXPECT_EQ(memoryOf(tree, MemoryComponent::kTreeNodes),
+            make_pair(3 * sizeof(StudentTree::Node), size_t(3)));
+  EXPECT_EQ(memoryOf(tree, MemoryComponent::kIndexNodes).second, 6u);
+  EXPECT_EQ(memoryOf(tree, MemoryComponent::kVersionNodes),
+            make_pair(3 * sizeof(SubjectVersionIndex::Node), size_t(3)));
+  // Two students and two subjects: one map node and one vector each.
+  EXPECT_EQ(memoryOf(tree, MemoryComponent::kMapNodes).second, 4u);
+  EXPECT_EQ(memoryOf(tree, MemoryComponent::kIndexVectors).second, 4u);
+  EXPECT_EQ(memoryOf(tree, MemoryComponent::kPayloadStrings).first,
+            long_name.size() + 1);
+  EXPECT_EQ(memoryOf(tree, MemoryComponent::kKeyStrings).first, 0u);
+
+  // A re-registration adds one version node and nothing else.
+  runLine(tree, "I 2 Misaso N 1 010 8");
+  EXPECT_EQ(memoryOf(tree, MemoryComponent::kIndexNodes).second, 6u);
+  EXPECT_EQ(memoryOf(tree, MemoryComponent::kPayloadStrings).second, 1u);
+  EXPECT_EQ(memoryOf(tree, MemoryComponent::kVersionNodes),
+            make_pair(4 * sizeof(SubjectVersionIndex::Node), size_t(4)));
+
+  runLine(tree, "F");
+  EXPECT_GT(memoryOf(tree, MemoryComponent::kFrozenLayout).first, 0u);
+  EXPECT_EQ(memoryOf(tree, MemoryComponent::kFrozenLayout).second, 8u);
+  runLine(tree, "T");
+  EXPECT_EQ(memoryOf(tree, MemoryComponent::kFrozenLayout).first, 0u);
+
+  // An insert into a frozen tree frees the layout as well.
+  runLine(tree, "F");
+  runLine(tree, "I 3 Misaso N 1 010 9");
+  EXPECT_EQ(memoryOf(tree, MemoryComponent::kFrozenLayout),
+            make_pair(size_t(0), size_t(0)));
+
+  const string report = runLine(tree, "S");
+  EXPECT_EQ(report.compare(0, 11, "tree_nodes "), 0);
+  EXPECT_NE(report.find(" total "), string::npos);
+}
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,1044 @@
+/*
+ * This is file of the project 2025_Lecture_Algorithm
+ * Licensed under the MIT License.
+ * Copyright (c) 2025 Junho Kim
+ * For full license text, see the LICENSE file in the root directory or at
+ * https://opensource.org/license/mit
+ * Author: Junho Kim
+ * Latest Updated Date: 2025-07-03
+ */
+#include "../../src/design_assignment_02/boruvka_mst.hpp"
+#include "../../src/design_assignment_02/cached_mst.hpp"
+#include "../../src/design_assignment_02/dynamic_mst.hpp"
+#include "../../src/design_assignment_02/kruskal_mst.hpp"
+#include "../../src/design_assignment_02/output_buffer.hpp"
+#include "../../src/design_assignment_02/prim_mst.hpp"
+#include "../../src/design_assignment_02/road_graph_file.hpp"
+#include "../../src/design_assignment_02/road_scenarios.hpp"
+#include "../../src/design_assignment_02/spanning_forest.hpp"
+#include <climits>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <random>
+#include <sstream>
+#include <thread>
+
+// Input and expected output of docs/sample-P2.1.
+static const char *kSampleInput =
+    "7\n"
+    "Andong 50\nBusan 100\nChangnyeong 30\nDaegu 0\nUlsan 0\n"
+    "Changwon 100\nGyeongju 150\n"
+    "15\n"
+    "Andong Busan 8000 1991-01\n"
+    "Andong Changnyeong 5000 1996-12\n"
+    "Andong Daegu 9000 1997-01\n"
+    "Busan Changnyeong 10000 1997-01\n"
+    "Busan Ulsan 12000 1997-01\n"
+    "Busan Daegu 20000 2002-01\n"
+    "Changnyeong Daegu 10000 2002-01\n"
+    "Daegu Ulsan 20000 2002-01\n"
+    "Changnyeong Changwon 20000 2003-01\n"
+    "Daegu Changwon 20000 2002-01\n"
+    "Busan Changwon 20000 2002-01\n"
+    "Ulsan Gyeongju 25000 2003-01\n"
+    "Changwon Gyeongju 20000 2002-01\n"
+    "Changnyeong Ulsan 12000 1997-01\n"
+    "Gyeongju Daegu 20000 2002-01\n"
+    "Andong\n";
+static const char *kSampleOutput = "Andong Busan\n"
+                                   "Andong Changnyeong\n"
+                                   "Andong Daegu\n"
+                                   "Changnyeong Ulsan\n"
+                                   "Busan Changwon\n"
+                                   "Changwon Gyeongju\n"
+                                   "74000\n"
+                                   "1991-01 Andong Busan 8000\n"
+                                   "1996-12 Andong Changnyeong 5000\n"
+                                   "1997-01 Andong Daegu 9000\n"
+                                   "2002-01 Busan Changwon 20000\n"
+                                   "1997-01 Changnyeong Ulsan 12000\n"
+                                   "2002-01 Changwon Gyeongju 20000\n";
+
+// Reads the city and road sections of 'input' into 'graph' and returns the
+// starting city.
+static string loadGraph(const string &input, RoadGraph &graph) {
+  istringstream in(input);
+  RoadGraphBuilder builder;
+  int count;
+  in >> count;
+  while (count--) {
+    string city;
+    int elevation;
+    in >> city >> elevation;
+    builder.addCity(city, elevation);
+  }
+  in >> count;
+  while (count--) {
+    string first_city, second_city, timestamp;
+    int road_length;
+    in >> first_city >> second_city >> road_length >> timestamp;
+    builder.addRoad(first_city, second_city, road_length, timestamp);
+  }
+  string starting_city;
+  in >> starting_city;
+  builder.build(graph);
+  return starting_city;
+}
+
+// Builds a random connected network of 'city_count' cities and
+// 'road_count' roads (at least city_count - 1).
+static void buildRandomGraph(size_t city_count, size_t road_count,
+                             unsigned seed, RoadGraph &graph) {
+  mt19937 generator(seed);
+  RoadGraphBuilder builder;
+  vector<string> names(city_count);
+  for (size_t i = 0; i < city_count; i++) {
+    names[i] = "c" + to_string(generator() % 1000) + "_" + to_string(i);
+    builder.addCity(names[i], static_cast<int>(generator() % 2000));
+  }
+  auto addRoad = [&](size_t first, size_t second) {
+    string timestamp = to_string(1985 + generator() % 40) + "-0" +
+                       to_string(1 + generator() % 9);
+    builder.addRoad(names[first], names[second],
+                    static_cast<int>(1 + generator() % 60) * 100, timestamp);
+  };
+  for (size_t i = 1; i < city_count; i++)
+    addRoad(i, generator() % i);
+  for (size_t i = city_count - 1; i < road_count; i++)
+    addRoad(generator() % city_count, generator() % city_count);
+  builder.build(graph);
+}
+
+// Runs the whole program on 'graph' from 'starting_city' and returns its
+// output.
+static string runPrim(const RoadGraph &graph, const string &starting_city,
+                      PrimMode mode = PrimMode::kLazy) {
+  ostringstream out;
+  MST mst(graph, out);
+  mst.setPrimMode(mode);
+  mst.setStartingNode(starting_city);
+  mst.initializeMST();
+  mst.printTotalElevationSum();
+  mst.printAllBridges();
+  return out.str();
+}
+
+TEST(RoadGraph, CityIdsFollowNameOrder) {
+  RoadGraph graph;
+  loadGraph(kSampleInput, graph);
+  ASSERT_EQ(graph.cityCount(), 7u);
+  for (CityId city = 1; city < graph.cityCount(); city++) {
+    EXPECT_LT(graph.cityName(city - 1), graph.cityName(city));
+  }
+  EXPECT_EQ(graph.cityName(graph.findCity("Daegu")), "Daegu");
+  EXPECT_EQ(graph.elevation(graph.findCity("Gyeongju")), 150);
+  EXPECT_EQ(graph.findCity("Seoul"), kInvalidCity);
+}
+
+TEST(RoadGraph, CsrListsEveryBridgeAtBothEnds) {
+  RoadGraph graph;
+  loadGraph(kSampleInput, graph);
+  ASSERT_EQ(graph.bridgeCount(), 15u);
+
+  size_t entry_count = 0;
+  for (CityId city = 0; city < graph.cityCount(); city++) {
+    for (const RoadGraph::Adjacency *entry = graph.adjacencyBegin(city);
+         entry != graph.adjacencyEnd(city); entry++) {
+      const CityId earlier = graph.earlierCity(entry->bridge);
+      const CityId later = graph.laterCity(entry->bridge);
+      EXPECT_TRUE(earlier == city || later == city);
+      EXPECT_EQ(entry->neighbor, (earlier == city) ? later : earlier);
+      entry_count++;
+    }
+  }
+  EXPECT_EQ(entry_count, 2 * graph.bridgeCount());
+  EXPECT_EQ(graph.degree(graph.findCity("Daegu")), 6u);
+
+  // Bridges keep input order; cities are stored as (earlier, later).
+  EXPECT_EQ(graph.cityName(graph.earlierCity(0)), "Andong");
+  EXPECT_EQ(graph.cityName(graph.laterCity(0)), "Busan");
+  EXPECT_EQ(graph.roadLength(0), 8000);
+  EXPECT_EQ(graph.elevationDifference(0), 50);
+  EXPECT_EQ(graph.bridgeBytes(),
+            graph.bridgeCount() * (BridgeColumns::kBytesPerBridge +
+                                   2 * sizeof(RoadGraph::Adjacency)));
+}
+
+TEST(PrimMST, SampleOutput) {
+  RoadGraph graph;
+  string starting_city = loadGraph(kSampleInput, graph);
+  EXPECT_EQ(runPrim(graph, starting_city), kSampleOutput);
+}
+
+TEST(PrimMST, EagerSampleOutput) {
+  RoadGraph graph;
+  string starting_city = loadGraph(kSampleInput, graph);
+  EXPECT_EQ(runPrim(graph, starting_city, PrimMode::kEager), kSampleOutput);
+}
+
+TEST(IndexedDaryHeap, PopsInPriorityOrderAfterImprovements) {
+  IndexedDaryHeap<int, less<int>, 3> heap(64);
+  mt19937 generator(7);
+  vector<int> best(64, -1);
+  for (int round = 0; round < 500; round++) {
+    uint32_t id = generator() % 64;
+    int value = static_cast<int>(generator() % 10000);
+    bool changed = heap.pushOrImprove(id, value);
+    EXPECT_EQ(changed, best[id] < value);
+    if (changed)
+      best[id] = value;
+  }
+  EXPECT_LE(heap.size(), 64u);
+  EXPECT_EQ(heap.peakSize(), heap.size());
+
+  int previous = 10000;
+  while (!heap.empty()) {
+    uint32_t id = heap.top();
+    EXPECT_EQ(heap.topValue(), best[id]);
+    EXPECT_LE(heap.topValue(), previous);
+    previous = heap.topValue();
+    heap.pop();
+    EXPECT_FALSE(heap.contains(id));
+  }
+}
+
+TEST(PrimMST, EagerMatchesLazyOnRandomGraphs) {
+  const size_t shapes[][2] = {{2, 1}, {50, 49}, {300, 1200}, {120, 7000}};
+  for (const size_t *shape : shapes) {
+    for (unsigned seed = 1; seed <= 3; seed++) {
+      RoadGraph graph;
+      buildRandomGraph(shape[0], shape[1], seed, graph);
+      const string &starting_city = graph.cityName(seed % shape[0]);
+
+      ostringstream lazy_out, eager_out;
+      MST lazy(graph, lazy_out);
+      lazy.setStartingNode(starting_city);
+      lazy.initializeMST();
+      MST eager(graph, eager_out);
+      eager.setPrimMode(PrimMode::kEager);
+      eager.setStartingNode(starting_city);
+      eager.initializeMST();
+
+      EXPECT_EQ(eager_out.str(), lazy_out.str());
+      EXPECT_EQ(eager.totalLength(), lazy.totalLength());
+      EXPECT_EQ(eager.bridges(), lazy.bridges());
+      EXPECT_EQ(lazy.bridges().size(), shape[0] - 1);
+      EXPECT_LT(eager.peakHeapSize(), shape[0]);
+    }
+  }
+}
+
+TEST(PrimMST, EagerMatchesLazyWithStartingSelfLoop) {
+  string input = kSampleInput;
+  input.replace(input.find("15\n"), 3, "17\n");
+  input.replace(input.find("Andong\n", input.size() - 8), 7,
+                "Andong Andong 4000 1990-01\n"
+                "Busan Busan 3000 1990-01\nAndong\n");
+  RoadGraph graph;
+  string starting_city = loadGraph(input, graph);
+  ASSERT_EQ(graph.bridgeCount(), 17u);
+
+  const string lazy_output = runPrim(graph, starting_city);
+  EXPECT_NE(lazy_output.find(kUnexpectedErrorMessage), string::npos);
+  EXPECT_EQ(runPrim(graph, starting_city, PrimMode::kEager), lazy_output);
+}
+
+// Duplicate roads are the documented exception: only the guard lines may
+// differ between the modes.
+TEST(PrimMST, EagerMatchesLazyApartFromDuplicateRoadGuards) {
+  string input = kSampleInput;
+  input.replace(input.find("15\n"), 3, "16\n");
+  input.replace(input.find("Andong\n", input.size() - 8), 7,
+                "Ulsan Busan 12000 1997-01\nAndong\n");
+  RoadGraph graph;
+  string starting_city = loadGraph(input, graph);
+
+  auto withoutGuards = [](const string &output) {
+    istringstream in(output);
+    string kept, line;
+    while (getline(in, line))
+      if (line != kUnexpectedErrorMessage)
+        kept += line + "\n";
+    return kept;
+  };
+  const string lazy_output = runPrim(graph, starting_city);
+  EXPECT_NE(lazy_output.find(kUnexpectedErrorMessage), string::npos);
+  EXPECT_EQ(withoutGuards(runPrim(graph, starting_city, PrimMode::kEager)),
+            withoutGuards(lazy_output));
+}
+
+// The comparator before packing: timestamp and city names as strings.
+struct FieldBridgeComparator {
+  const RoadGraph *graph;
+
+  bool operator()(BridgeId a, BridgeId b) const {
+    const string &a_timestamp = graph->timestampName(graph->timestamp(a));
+    const string &b_timestamp = graph->timestampName(graph->timestamp(b));
+    if (a_timestamp != b_timestamp)
+      return a_timestamp > b_timestamp;
+    if (graph->roadLength(a) != graph->roadLength(b))
+      return graph->roadLength(a) > graph->roadLength(b);
+    if (graph->elevationDifference(a) != graph->elevationDifference(b))
+      return graph->elevationDifference(a) > graph->elevationDifference(b);
+    const string &a_earlier = graph->cityName(graph->earlierCity(a));
+    const string &b_earlier = graph->cityName(graph->earlierCity(b));
+    if (a_earlier != b_earlier)
+      return a_earlier > b_earlier;
+    return graph->cityName(graph->laterCity(a)) >
+           graph->cityName(graph->laterCity(b));
+  }
+};
+
+TEST(PriorityKey, LayoutWidths) {
+  EXPECT_EQ(PriorityKeyLayout::bitsFor(0), 0u);
+  EXPECT_EQ(PriorityKeyLayout::bitsFor(1), 1u);
+  EXPECT_EQ(PriorityKeyLayout::bitsFor(255), 8u);
+  EXPECT_EQ(PriorityKeyLayout::bitsFor(256), 9u);
+
+  // 480 timestamps, lengths 100..6000, differences 0..2000, 2M cities.
+  PriorityKeyLayout layout(480, 100, 6000, 0, 2000, 2000000);
+  EXPECT_EQ(layout.totalBits(), 9u + 13u + 11u + 2 * 21u);
+  EXPECT_TRUE(layout.fits());
+
+  // Full-range lengths and differences with 2^31 cities need 158 bits.
+  PriorityKeyLayout wide(1u << 30, INT32_MIN, INT32_MAX, 0, INT32_MAX,
+                         1ull << 31);
+  EXPECT_EQ(wide.totalBits(), 30u + 32u + 31u + 2 * 31u);
+  EXPECT_FALSE(wide.fits());
+}
+
+TEST(PriorityKey, AppendCarriesAcrossWords) {
+  PriorityKey key = {0, 0};
+  key.append(0xABCDu, 16);
+  key.append(0xFFFFFFFFu, 32);
+  key.append(0xFFFFFFFFu, 32);
+  EXPECT_EQ(key.high, 0xABCDu);
+  EXPECT_EQ(key.low, ~0ull);
+  EXPECT_LT((PriorityKey{0xABCDu, ~0ull}), (PriorityKey{0xABCEu, 0}));
+}
+
+// Packed keys (and rank keys) must order every pair of bridges exactly like
+// the field-by-field string comparison, for narrow and wide value ranges.
+TEST(PriorityKey, OrderMatchesFieldComparison) {
+  struct Shape {
+    int min_length, max_length, max_elevation;
+    bool ragged_timestamps;
+  };
+  const Shape shapes[] = {{1, 60, 2000, false},
+                          {-1000000, 1000000, 1000, true},
+                          {INT32_MIN / 2, INT32_MAX / 2, 1000000000, true},
+                          {7, 7, 0, false}};
+  for (const Shape &shape : shapes) {
+    mt19937 generator(static_cast<unsigned>(shape.max_length));
+    uniform_int_distribution<int> length(shape.min_length, shape.max_length);
+    uniform_int_distribution<int> elevation(0, shape.max_elevation);
+
+    RoadGraphBuilder builder;
+    vector<string> names(200);
+    for (size_t i = 0; i < names.size(); i++) {
+      names[i] = string(1 + generator() % 3, static_cast<char>('a' + i % 7)) +
+                 to_string(i);
+      builder.addCity(names[i], elevation(generator));
+    }
+    for (int i = 0; i < 3000; i++) {
+      // Ragged timestamps ("2001-3" vs "2001-10") only order as strings.
+      unsigned month = 1 + generator() % 12;
+      string timestamp =
+          to_string(1990 + generator() % 5) +
+          ((shape.ragged_timestamps || month >= 10) ? "-" : "-0") +
+          to_string(month);
+      builder.addRoad(names[generator() % names.size()],
+                      names[generator() % names.size()], length(generator),
+                      timestamp);
+    }
+    RoadGraph graph;
+    builder.build(graph);
+
+    vector<PriorityKey> ranked(graph.bridgeCount());
+    assignRankKeys(
+        graph.bridgeCount(),
+        [&graph](BridgeId id) {
+          return make_tuple(graph.timestamp(id), graph.roadLength(id),
+                            graph.elevationDifference(id),
+                            graph.earlierCity(id), graph.laterCity(id));
+        },
+        ranked.data());
+
+    FieldBridgeComparator by_fields{&graph};
+    BridgeComparator by_key(graph, cout);
+    for (BridgeId a = 0; a < graph.bridgeCount(); a += 7) {
+      for (BridgeId b = 0; b < graph.bridgeCount(); b += 5) {
+        if (graph.priority(a) == graph.priority(b)) {
+          // Only a bridge repeated with identical fields may tie.
+          ASSERT_FALSE(by_fields(a, b));
+          ASSERT_FALSE(by_fields(b, a));
+          continue;
+        }
+        ASSERT_EQ(by_key(a, b), by_fields(a, b));
+        ASSERT_EQ(ranked[a] > ranked[b], by_fields(a, b));
+      }
+    }
+  }
+}
+
+TEST(DisjointSet, UnitesAndFinds) {
+  DisjointSet sets(10);
+  EXPECT_TRUE(sets.unite(1, 2));
+  EXPECT_TRUE(sets.unite(3, 4));
+  EXPECT_TRUE(sets.unite(2, 4));
+  EXPECT_FALSE(sets.unite(1, 3));
+  EXPECT_EQ(sets.find(1), sets.find(4));
+  EXPECT_NE(sets.find(1), sets.find(5));
+  EXPECT_EQ(sets.find(9), 9u);
+}
+
+TEST(ParallelSort, MatchesStdSort) {
+  mt19937 generator(11);
+  for (size_t count : {size_t(0), size_t(1000), size_t(100000),
+                       size_t(300001)}) {
+    vector<uint32_t> values(count);
+    for (uint32_t &value : values)
+      value = generator() % 50000;
+    vector<uint32_t> expected = values;
+    sort(expected.begin(), expected.end());
+    for (int thread_count : {1, 2, 3, 8}) {
+      vector<uint32_t> sorted = values;
+      parallelSort(sorted, less<uint32_t>(), thread_count);
+      EXPECT_EQ(sorted, expected) << count << " values, " << thread_count
+                                  << " threads";
+    }
+  }
+}
+
+TEST(KruskalMST, MatchesPrimTotalAndBridges) {
+  const size_t shapes[][2] = {{2, 1}, {300, 1200}, {20000, 80000}};
+  for (const size_t *shape : shapes) {
+    RoadGraph graph;
+    buildRandomGraph(shape[0], shape[1], 5, graph);
+
+    ostringstream prim_out, kruskal_out;
+    MST prim(graph, prim_out);
+    prim.setStartingNode(graph.cityName(0));
+    prim.initializeMST();
+    prim_out.str("");
+    prim.printTotalElevationSum();
+    prim.printAllBridges();
+
+    KruskalMST kruskal(graph, kruskal_out);
+    kruskal.setThreadCount(4);
+    kruskal.initializeMST();
+    kruskal.printTotalElevationSum();
+    kruskal.printAllBridges();
+
+    EXPECT_EQ(kruskal_out.str(), prim_out.str());
+    EXPECT_EQ(kruskal.totalLength(), prim.totalLength());
+  }
+}
+
+TEST(KruskalMST, SpansEveryComponent) {
+  RoadGraphBuilder builder;
+  for (const char *city : {"a", "b", "c", "x", "y", "z"})
+    builder.addCity(city, 0);
+  builder.addRoad("a", "b", 5, "2001-01");
+  builder.addRoad("b", "c", 3, "2001-01");
+  builder.addRoad("a", "c", 1, "2002-01");
+  builder.addRoad("x", "y", 7, "1999-01");
+  RoadGraph graph;
+  builder.build(graph);
+
+  ostringstream out;
+  KruskalMST kruskal(graph, out);
+  kruskal.initializeMST();
+  kruskal.printTotalElevationSum();
+  kruskal.printAllBridges();
+  EXPECT_EQ(out.str(), "15\n"
+                       "2001-01 a b 5\n"
+                       "2001-01 b c 3\n"
+                       "1999-01 x y 7\n");
+}
+
+TEST(ConcurrentDisjointSet, ConcurrentUnitesSucceedOncePerMerge) {
+  const uint32_t count = 20000;
+  ConcurrentDisjointSet sets(count);
+  atomic<int> successes(0);
+  vector<thread> workers;
+  for (int worker = 0; worker < 4; worker++) {
+    workers.emplace_back([&, worker]() {
+      // Every worker tries every chain link; each link merges only once.
+      for (uint32_t i = 1; i < count; i++) {
+        uint32_t id = (i + worker * 4999) % (count - 1) + 1;
+        if (sets.unite(id - 1, id))
+          successes++;
+      }
+    });
+  }
+  for (thread &worker : workers)
+    worker.join();
+  EXPECT_EQ(successes.load(), static_cast<int>(count - 1));
+  for (uint32_t id = 0; id < count; id++)
+    EXPECT_EQ(sets.find(id), 0u);
+}
+
+// Builds 'copy_count' disjoint copies of a random network; copy k's city
+// names end in "#k".
+static void buildRandomForest(size_t city_count, size_t road_count,
+                              size_t copy_count, RoadGraph &graph) {
+  RoadGraph part;
+  buildRandomGraph(city_count, road_count, 9, part);
+  RoadGraphBuilder builder;
+  for (size_t copy = 0; copy < copy_count; copy++) {
+    const string suffix = "#" + to_string(copy);
+    for (CityId city = 0; city < part.cityCount(); city++)
+      builder.addCity(part.cityName(city) + suffix, part.elevation(city));
+    for (BridgeId id = 0; id < part.bridgeCount(); id++) {
+      builder.addRoad(part.cityName(part.earlierCity(id)) + suffix,
+                      part.cityName(part.laterCity(id)) + suffix,
+                      part.roadLength(id),
+                      part.timestampName(part.timestamp(id)));
+    }
+  }
+  builder.build(graph);
+}
+
+TEST(BoruvkaMST, MatchesKruskalForEveryThreadCount) {
+  const size_t shapes[][3] = {{2, 1, 1}, {300, 1200, 1}, {20000, 80000, 1},
+                              {5000, 5000, 3}};
+  for (const size_t *shape : shapes) {
+    RoadGraph graph;
+    if (shape[2] == 1)
+      buildRandomGraph(shape[0], shape[1], 9, graph);
+    else
+      buildRandomForest(shape[0], shape[1], shape[2], graph);
+
+    ostringstream kruskal_out;
+    KruskalMST kruskal(graph, kruskal_out);
+    kruskal.initializeMST();
+    kruskal.printTotalElevationSum();
+    kruskal.printAllBridges();
+
+    for (int thread_count : {1, 2, 5}) {
+      ostringstream boruvka_out;
+      BoruvkaMST boruvka(graph, boruvka_out);
+      boruvka.setThreadCount(thread_count);
+      boruvka.initializeMST();
+      boruvka.printTotalElevationSum();
+      boruvka.printAllBridges();
+      EXPECT_EQ(boruvka_out.str(), kruskal_out.str());
+      EXPECT_LE(boruvka.getRoundCount(), 20);
+    }
+  }
+}
+
+TEST(SpanningForest, EveryComponentMatchesASingleTreeRun) {
+  RoadGraph graph;
+  buildRandomForest(400, 1500, 5, graph);
+  const string requested = graph.cityName(graph.cityCount() - 1);
+
+  string expected;
+  for (int thread_count : {1, 3}) {
+    ostringstream out;
+    SpanningForest forest(graph, out);
+    forest.setThreadCount(thread_count);
+    forest.setStartingNode(requested);
+    forest.initializeForest();
+    forest.printForest();
+    if (expected.empty())
+      expected = out.str();
+    EXPECT_EQ(out.str(), expected);
+
+    const vector<ForestComponent> &components = forest.getComponents();
+    ASSERT_EQ(components.size(), 5u);
+    EXPECT_EQ(components[0].starting_city, graph.findCity(requested));
+    long long total = 0;
+    for (size_t i = 0; i < components.size(); i++) {
+      const ForestComponent &component = components[i];
+      EXPECT_EQ(component.city_count, 400u);
+      if (i > 1) {
+        EXPECT_LT(graph.cityName(components[i - 1].starting_city),
+                  graph.cityName(component.starting_city));
+      }
+      EXPECT_EQ(component.report,
+                runPrim(graph, graph.cityName(component.starting_city)));
+      total += component.total_length;
+    }
+    EXPECT_EQ(forest.totalLength(), total);
+  }
+}
+
+TEST(SpanningForest, CitiesWithoutBridgesAreSkipped) {
+  RoadGraphBuilder builder;
+  for (const char *city : {"a", "b", "lonely", "x", "y"})
+    builder.addCity(city, 0);
+  builder.addRoad("y", "x", 4, "2000-01");
+  builder.addRoad("a", "b", 2, "2001-01");
+  RoadGraph graph;
+  builder.build(graph);
+
+  ostringstream out;
+  SpanningForest forest(graph, out);
+  forest.setThreadCount(2);
+  forest.setStartingNode("y");
+  forest.initializeForest();
+  forest.printForest();
+  EXPECT_EQ(out.str(), "2\n"
+                       "y 2\n"
+                       "x y\n4\n2000-01 x y 4\n"
+                       "a 2\n"
+                       "a b\n2\n2001-01 a b 2\n");
+}
+
+TEST(SpanningForest, GuardMessagesStayInTheirBlock) {
+  RoadGraphBuilder builder;
+  for (const char *city : {"a", "b", "x", "y"})
+    builder.addCity(city, 0);
+  builder.addRoad("y", "x", 4, "2000-01");
+  builder.addRoad("a", "b", 2, "2001-01");
+  // A self-loop at a starting city is pushed twice and ties with itself.
+  builder.addRoad("a", "a", 7, "1999-01");
+  RoadGraph graph;
+  builder.build(graph);
+  const string a_report = runPrim(graph, "a");
+  ASSERT_NE(a_report.find(kUnexpectedErrorMessage), string::npos);
+
+  for (int thread_count : {1, 2}) {
+    ostringstream out;
+    SpanningForest forest(graph, out);
+    forest.setThreadCount(thread_count);
+    forest.setStartingNode("y");
+    forest.initializeForest();
+    forest.printForest();
+    EXPECT_EQ(out.str(),
+              "2\ny 2\n" + runPrim(graph, "y") + "a 2\n" + a_report);
+  }
+}
+
+TEST(DynamicMST, SwapsOutTheCycleWorstBridge) {
+  RoadGraphBuilder builder;
+  for (const char *city : {"a", "b", "c", "d"})
+    builder.addCity(city, 0);
+  builder.addRoad("a", "b", 5, "2001-01");
+  builder.addRoad("b", "c", 3, "2003-01");
+  RoadGraph graph;
+  builder.build(graph);
+
+  ostringstream out;
+  DynamicMST dynamic(graph, out);
+  dynamic.initializeMST();
+  EXPECT_EQ(dynamic.addBridge("c", "d", 4, "2000-01"),
+            BridgeInsertion::kLinked);
+  dynamic.printLastInsertion();
+  EXPECT_EQ(dynamic.addBridge("a", "c", 9, "2002-01"),
+            BridgeInsertion::kSwapped);
+  dynamic.printLastInsertion();
+  EXPECT_EQ(dynamic.addBridge("b", "c", 1, "2004-01"),
+            BridgeInsertion::kRejected);
+  dynamic.printLastInsertion();
+  EXPECT_EQ(dynamic.addBridge("a", "e", 1, "2000-01"),
+            BridgeInsertion::kUnknownCity);
+  EXPECT_EQ(dynamic.addBridge("d", "d", 1, "1990-01"),
+            BridgeInsertion::kRejected);
+  dynamic.printAllBridges();
+  EXPECT_EQ(out.str(), "+ 2000-01 c d 4\n"
+                       "12\n"
+                       "+ 2002-01 a c 9\n"
+                       "- 2003-01 b c 3\n"
+                       "18\n"
+                       "18\n"
+                       "2001-01 a b 5\n"
+                       "2002-01 a c 9\n"
+                       "2000-01 c d 4\n");
+  EXPECT_EQ(dynamic.totalLength(), 18);
+  EXPECT_EQ(dynamic.bridgeCount(), 3u);
+}
+
+TEST(DynamicMST, MatchesKruskalRebuiltAfterInsertions) {
+  const size_t city_count = 300;
+  mt19937 generator(11);
+  vector<string> names(city_count);
+  vector<int> elevations(city_count);
+  for (size_t i = 0; i < city_count; i++) {
+    names[i] = "c" + to_string(generator() % 1000) + "_" + to_string(i);
+    elevations[i] = static_cast<int>(generator() % 2000);
+  }
+  struct Road {
+    size_t first, second;
+    int length;
+    string timestamp;
+  };
+  vector<Road> roads(1500);
+  for (Road &road : roads) {
+    road.first = generator() % city_count;
+    road.second = generator() % city_count;
+    road.length = static_cast<int>(1 + generator() % 60) * 100;
+    road.timestamp = to_string(1985 + generator() % 40) + "-0" +
+                     to_string(1 + generator() % 9);
+  }
+  // Every city is known from the start; the first roads leave the network
+  // disconnected, so insertions both link trees and close cycles.
+  auto buildPrefix = [&](size_t road_count, RoadGraph &graph) {
+    RoadGraphBuilder builder;
+    for (size_t i = 0; i < city_count; i++)
+      builder.addCity(names[i], elevations[i]);
+    for (size_t i = 0; i < road_count; i++)
+      builder.addRoad(names[roads[i].first], names[roads[i].second],
+                      roads[i].length, roads[i].timestamp);
+    builder.build(graph);
+  };
+
+  const size_t initial_count = 200;
+  RoadGraph initial;
+  buildPrefix(initial_count, initial);
+  ostringstream dynamic_out;
+  DynamicMST dynamic(initial, dynamic_out);
+  dynamic.initializeMST(2);
+
+  for (size_t i = initial_count; i < roads.size(); i++) {
+    dynamic.addBridge(names[roads[i].first], names[roads[i].second],
+                      roads[i].length, roads[i].timestamp);
+    if ((i + 1) % 260 != 0 && i + 1 != roads.size())
+      continue;
+
+    RoadGraph rebuilt;
+    buildPrefix(i + 1, rebuilt);
+    ostringstream kruskal_out;
+    KruskalMST kruskal(rebuilt, kruskal_out);
+    kruskal.initializeMST();
+    kruskal.printTotalElevationSum();
+    kruskal.printAllBridges();
+
+    dynamic_out.str("");
+    dynamic.printTotalElevationSum();
+    dynamic.printAllBridges();
+    EXPECT_EQ(dynamic_out.str(), kruskal_out.str()) << "after " << i + 1;
+    EXPECT_EQ(dynamic.bridgeCount(), kruskal.bridges().size());
+  }
+}
+
+TEST(CachedMST, EveryStartMatchesAFreshRun) {
+  RoadGraph graph;
+  buildRandomForest(400, 1600, 3, graph);
+  ostringstream cached_out;
+  CachedMST cached(graph, cached_out);
+  cached.setThreadCount(2);
+  cached.initializeMST();
+  EXPECT_EQ(cached.bridgeCount(), graph.cityCount() - 3);
+
+  // Starts in every component, the same start twice, and a missing city.
+  vector<string> starts = {"missing"};
+  for (CityId city = 0; city < graph.cityCount(); city += 97)
+    starts.push_back(graph.cityName(city));
+  starts.push_back(starts[1]);
+  for (const string &starting_city : starts) {
+    cached_out.str("");
+    const long long total = cached.printFromStart(starting_city);
+
+    ostringstream fresh_out;
+    MST fresh(graph, fresh_out);
+    fresh.setStartingNode(starting_city);
+    fresh.initializeMST();
+    fresh.printTotalElevationSum();
+    fresh.printAllBridges();
+    EXPECT_EQ(cached_out.str(), fresh_out.str()) << starting_city;
+    EXPECT_EQ(total, fresh.totalLength());
+  }
+}
+
+TEST(ScenarioBatch, SampleScenariosMatchEditedInputs) {
+  RoadGraph base;
+  const string starting_city = loadGraph(kSampleInput, base);
+
+  // Close "Andong Busan", open a road to a new city and raise Ulsan.
+  RoadScenario edited;
+  edited.starting_city = "Busan";
+  edited.closed_bridges.push_back(0);
+  edited.added_roads.push_back(
+      ScenarioRoad{"Pohang", "Gyeongju", 3000, "1990-05"});
+  edited.city_elevations.push_back(make_pair("Pohang", 20));
+  edited.city_elevations.push_back(make_pair("Ulsan", 400));
+  RoadScenario unchanged;
+  unchanged.starting_city = starting_city;
+
+  ScenarioBatch batch(base);
+  batch.setThreadCount(2);
+  vector<ScenarioResult> results = batch.run({edited, unchanged, edited});
+  ASSERT_EQ(results.size(), 3u);
+
+  RoadGraph expected_graph;
+  loadGraph("8\n"
+            "Andong 50\nBusan 100\nChangnyeong 30\nDaegu 0\nUlsan 400\n"
+            "Changwon 100\nGyeongju 150\nPohang 20\n"
+            "15\n"
+            "Andong Changnyeong 5000 1996-12\n"
+            "Andong Daegu 9000 1997-01\n"
+            "Busan Changnyeong 10000 1997-01\n"
+            "Busan Ulsan 12000 1997-01\n"
+            "Busan Daegu 20000 2002-01\n"
+            "Changnyeong Daegu 10000 2002-01\n"
+            "Daegu Ulsan 20000 2002-01\n"
+            "Changnyeong Changwon 20000 2003-01\n"
+            "Daegu Changwon 20000 2002-01\n"
+            "Busan Changwon 20000 2002-01\n"
+            "Ulsan Gyeongju 25000 2003-01\n"
+            "Changwon Gyeongju 20000 2002-01\n"
+            "Changnyeong Ulsan 12000 1997-01\n"
+            "Gyeongju Daegu 20000 2002-01\n"
+            "Pohang Gyeongju 3000 1990-05\n"
+            "Busan\n",
+            expected_graph);
+  const string expected = runPrim(expected_graph, "Busan");
+  EXPECT_EQ(results[0].report, expected);
+  EXPECT_EQ(results[1].report, kSampleOutput);
+  EXPECT_EQ(results[2].report, expected);
+  EXPECT_EQ(results[1].total_length, 74000);
+  EXPECT_EQ(results[0].bridge_count, 7u);
+}
+
+TEST(ScenarioBatch, ParallelBatchMatchesSerialRuns) {
+  RoadGraph base;
+  buildRandomGraph(300, 1200, 21, base);
+  mt19937 generator(21);
+  vector<RoadScenario> scenarios(24);
+  for (RoadScenario &scenario : scenarios) {
+    scenario.starting_city = base.cityName(generator() % base.cityCount());
+    for (int i = 0; i < 40; i++)
+      scenario.closed_bridges.push_back(generator() % base.bridgeCount());
+    for (int i = 0; i < 10; i++) {
+      scenario.added_roads.push_back(ScenarioRoad{
+          base.cityName(generator() % base.cityCount()),
+          base.cityName(generator() % base.cityCount()),
+          static_cast<int>(1 + generator() % 60) * 100, "1984-01"});
+    }
+  }
+
+  ScenarioBatch batch(base);
+  batch.setThreadCount(4);
+  batch.setPrimMode(PrimMode::kEager);
+  vector<ScenarioResult> results = batch.run(scenarios);
+  ASSERT_EQ(results.size(), scenarios.size());
+  batch.setPrimMode(PrimMode::kLazy);
+  for (size_t i = 0; i < scenarios.size(); i++) {
+    ScenarioResult serial = batch.evaluate(scenarios[i]);
+    EXPECT_EQ(results[i].report, serial.report) << "scenario " << i;
+    EXPECT_EQ(results[i].total_length, serial.total_length);
+  }
+}
+
+TEST(ScenarioBatch, GuardMessagesGoToTheReport) {
+  RoadGraph base;
+  loadGraph(kSampleInput, base);
+
+  // A self-loop at the starting city is pushed twice and ties with itself.
+  RoadScenario looped;
+  looped.starting_city = "Busan";
+  looped.added_roads.push_back(ScenarioRoad{"Busan", "Busan", 500, "1980-01"});
+
+  // The same network, built in the order evaluate() adds it.
+  RoadGraphBuilder builder;
+  for (CityId city = 0; city < base.cityCount(); city++)
+    builder.addCity(base.cityName(city), base.elevation(city));
+  for (BridgeId id = 0; id < base.bridgeCount(); id++) {
+    builder.addRoad(base.cityName(base.earlierCity(id)),
+                    base.cityName(base.laterCity(id)), base.roadLength(id),
+                    base.timestampName(base.timestamp(id)));
+  }
+  builder.addRoad("Busan", "Busan", 500, "1980-01");
+  RoadGraph expected_graph;
+  builder.build(expected_graph);
+  const string expected = runPrim(expected_graph, "Busan");
+  ASSERT_NE(expected.find(kUnexpectedErrorMessage), string::npos);
+
+  ScenarioBatch batch(base);
+  batch.setThreadCount(2);
+  testing::internal::CaptureStdout();
+  vector<ScenarioResult> results = batch.run({looped, looped, looped});
+  EXPECT_EQ(testing::internal::GetCapturedStdout(), "");
+  for (const ScenarioResult &result : results)
+    EXPECT_EQ(result.report, expected);
+}
+
+TEST(RoadGraphFile, LoadedGraphMatchesTextBuild) {
+  const string path = testing::TempDir() + "prim_mst_test_graph.bin";
+  RoadGraph text_graph;
+  const string starting_city = loadGraph(kSampleInput, text_graph);
+  ASSERT_TRUE(RoadGraphFile::write(text_graph, path));
+
+  RoadGraph file_graph;
+  ASSERT_TRUE(RoadGraphFile::load(path, file_graph));
+  remove(path.c_str());
+  EXPECT_EQ(file_graph.cityCount(), text_graph.cityCount());
+  EXPECT_EQ(file_graph.bridgeCount(), text_graph.bridgeCount());
+  EXPECT_EQ(file_graph.bridgeBytes(), text_graph.bridgeBytes());
+  EXPECT_EQ(runPrim(file_graph, starting_city), kSampleOutput);
+  EXPECT_EQ(runPrim(file_graph, starting_city, PrimMode::kEager),
+            kSampleOutput);
+
+  // A larger network, where every city has several bridges.
+  RoadGraph random_graph;
+  buildRandomGraph(500, 3000, 49, random_graph);
+  ASSERT_TRUE(RoadGraphFile::write(random_graph, path));
+  ASSERT_TRUE(RoadGraphFile::load(path, file_graph));
+  remove(path.c_str());
+  for (CityId city = 0; city < random_graph.cityCount(); city += 123) {
+    const string &name = random_graph.cityName(city);
+    EXPECT_EQ(runPrim(file_graph, name), runPrim(random_graph, name));
+  }
+}
+
+TEST(RoadGraphFile, GuardMessagesReplayAndBadFilesAreRejected) {
+  const string path = testing::TempDir() + "prim_mst_test_guard.bin";
+  RoadGraph text_graph;
+  ostringstream text_errors;
+  RoadGraphBuilder builder;
+  builder.addCity("A", 10);
+  builder.addRoad("A", "B", 100, "2001-01");
+  builder.build(text_graph, text_errors);
+  EXPECT_EQ(text_graph.unelevatedRoadCount(), 1u);
+  ASSERT_TRUE(RoadGraphFile::write(text_graph, path));
+
+  RoadGraph file_graph;
+  ostringstream file_errors;
+  ASSERT_TRUE(RoadGraphFile::load(path, file_graph, file_errors));
+  EXPECT_EQ(file_errors.str(), text_errors.str());
+
+  // Truncated and foreign files leave the loaded graph as it was.
+  string bytes;
+  {
+    ifstream in(path, ios::binary);
+    bytes.assign(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+  }
+  {
+    ofstream out(path, ios::binary | ios::trunc);
+    out.write(bytes.data(), bytes.size() - 8);
+  }
+  EXPECT_FALSE(RoadGraphFile::load(path, file_graph));
+  bytes[0] = 'X';
+  {
+    ofstream out(path, ios::binary | ios::trunc);
+    out.write(bytes.data(), bytes.size());
+  }
+  EXPECT_FALSE(RoadGraphFile::load(path, file_graph));
+  remove(path.c_str());
+  EXPECT_FALSE(RoadGraphFile::load(path, file_graph));
+  EXPECT_EQ(runPrim(file_graph, "A"), runPrim(text_graph, "A"));
+}
+
+TEST(RoadGraphFile, OutOfRangeIdsAreRejected) {
+  const string path = testing::TempDir() + "prim_mst_test_corrupt.bin";
+  RoadGraph text_graph;
+  const string starting_city = loadGraph(kSampleInput, text_graph);
+  ASSERT_TRUE(RoadGraphFile::write(text_graph, path));
+  string bytes;
+  {
+    ifstream in(path, ios::binary);
+    bytes.assign(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+  }
+
+  // Section starts, following the layout in road_graph_file.hpp.
+  RoadGraphFileHeader header;
+  memcpy(&header, bytes.data(), sizeof(header));
+  size_t cursor = sizeof(header);
+  auto nextSection = [&cursor](size_t section_bytes) {
+    const size_t start = (cursor + 7) & ~static_cast<size_t>(7);
+    cursor = start + section_bytes;
+    return start;
+  };
+  nextSection((header.city_count + 1) * sizeof(uint64_t));
+  nextSection((header.timestamp_count + 1) * sizeof(uint64_t));
+  const size_t strings_at = nextSection(header.string_bytes);
+  nextSection(header.city_count * sizeof(int));
+  const size_t offsets_at =
+      nextSection((header.city_count + 1) * sizeof(uint64_t));
+  const size_t adjacency_at =
+      nextSection(header.adjacency_count * sizeof(RoadGraph::Adjacency));
+  const size_t bridges_at = nextSection(0);
+  const size_t earlier_at =
+      bridges_at + header.bridge_count * sizeof(PriorityKey);
+  const size_t timestamps_at =
+      earlier_at + header.bridge_count * (2 * sizeof(CityId) + sizeof(int));
+
+  // Loads 'bytes' with one value overwritten at 'at'.
+  RoadGraph file_graph;
+  ASSERT_TRUE(RoadGraphFile::load(path, file_graph));
+  auto loadPatched = [&](size_t at, const void *value, size_t size) {
+    string patched = bytes;
+    memcpy(&patched[at], value, size);
+    {
+      ofstream out(path, ios::binary | ios::trunc);
+      out.write(patched.data(), patched.size());
+    }
+    return RoadGraphFile::load(path, file_graph);
+  };
+
+  const uint64_t huge_offset = 1000000000000ULL;
+  EXPECT_FALSE(loadPatched(offsets_at + header.city_count * sizeof(uint64_t),
+                           &huge_offset, sizeof(huge_offset)));
+  const uint64_t past_end = header.adjacency_count + 1;
+  EXPECT_FALSE(loadPatched(offsets_at + sizeof(uint64_t), &past_end,
+                           sizeof(past_end)));
+  const uint32_t no_city = static_cast<uint32_t>(header.city_count);
+  const uint32_t no_bridge = static_cast<uint32_t>(header.bridge_count);
+  const uint32_t no_timestamp = static_cast<uint32_t>(header.timestamp_count);
+  EXPECT_FALSE(loadPatched(adjacency_at + offsetof(RoadGraph::Adjacency,
+                                                   neighbor),
+                           &no_city, sizeof(no_city)));
+  EXPECT_FALSE(loadPatched(adjacency_at + offsetof(RoadGraph::Adjacency,
+                                                   bridge),
+                           &no_bridge, sizeof(no_bridge)));
+  EXPECT_FALSE(loadPatched(earlier_at, &no_city, sizeof(no_city)));
+  EXPECT_FALSE(loadPatched(timestamps_at, &no_timestamp,
+                           sizeof(no_timestamp)));
+  // The first city name now sorts after every other one.
+  const char last_letter = '~';
+  EXPECT_FALSE(loadPatched(strings_at, &last_letter, 1));
+  remove(path.c_str());
+
+  // Every rejected file left the first load in place.
+  EXPECT_EQ(runPrim(file_graph, starting_city), kSampleOutput);
+}
+
+TEST(LineWriter, IntegersMatchStreamFormatting) {
+  ostringstream written, expected;
+  LineWriter writer(written);
+  for (long long value : {0LL, 7LL, -1LL, 74000LL, -1234567890123LL,
+                          LLONG_MAX, LLONG_MIN}) {
+    writer.integer(value).character(' ');
+    expected << value << ' ';
+  }
+  writer.text("end").endLine();
+  expected << "end\n";
+  EXPECT_EQ(written.str(), expected.str());
+
+  // A stream without a buffer drops the line.
+  ostream null_out(nullptr);
+  LineWriter(null_out).text("dropped").integer(-5).endLine();
+}
+
+TEST(BulkOutputBuffer, KeepsLineOrderAndPassesEverythingOn) {
+  RoadGraph graph;
+  const string starting_city = loadGraph(kSampleInput, graph);
+  ostringstream out;
+  streambuf *own_buffer = out.rdbuf();
+  {
+    // A capacity far below one report forces many partial hand-offs, with
+    // operator<< and LineWriter writing in between.
+    BulkOutputBuffer buffer(out, 7);
+    out << "header " << 1 << "\n";
+    MST mst(graph, out);
+    mst.setStartingNode(starting_city);
+    mst.initializeMST();
+    mst.printTotalElevationSum();
+    mst.printAllBridges();
+    out << "footer\n";
+    out.flush();
+    EXPECT_EQ(static_cast<ostream &>(out).rdbuf(), &buffer);
+  }
+  EXPECT_EQ(static_cast<ostream &>(out).rdbuf(), own_buffer);
+  EXPECT_EQ(out.str(), string("header 1\n") + kSampleOutput + "footer\n");
+}
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}